@@ -0,0 +1,114 @@
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+#include "allocators/ArenaAllocator.hpp"
+#include "allocators/PoolAllocator.hpp"
+#include "bench.hpp"
+#include "data-structures/BinSearchTree.hpp"
+#include "data-structures/Fila.hpp"
+#include "data-structures/Lista.hpp"
+#include "data-structures/Pilha.hpp"
+
+/**
+ * @brief Enche o container, alterna inserções e remoções e depois o destrói, reportando o tempo de
+ * cada fase
+ *
+ */
+template <typename Container, typename Alocador, typename Encher, typename Alternar>
+void medir(const char* nome, const Alocador& alocador, Encher encher, Alternar alternar) {
+  Container* container = new Container(alocador);
+
+  double enchimento = bench::medir([&] { encher(*container); });
+  double alternancia = bench::medir([&] { alternar(*container); });
+  double destruicao = bench::medir([&] { delete container; });
+
+  std::cout << "  " << nome << ": enchimento " << enchimento << " s, alternancia " << alternancia
+            << " s, destruicao " << destruicao << " s" << std::endl;
+}
+
+/**
+ * @brief Mede o mesmo container com o alocador padrão (o comportamento anterior), com o
+ * `PoolAllocator` e com o `ArenaAllocator`
+ *
+ */
+template <template <typename, typename> class Container, typename Encher, typename Alternar>
+void comparar(const char* nomeContainer, Encher encher, Alternar alternar) {
+  std::cout << nomeContainer << std::endl;
+
+  medir<Container<long long, std::allocator<long long>>>(
+      "std::allocator", std::allocator<long long>(), encher, alternar);
+
+  PoolMemoria pool;
+  medir<Container<long long, PoolAllocator<long long>>>("PoolAllocator",
+                                                         PoolAllocator<long long>(pool), encher,
+                                                         alternar);
+
+  ArenaMemoria arena;
+  medir<Container<long long, ArenaAllocator<long long>>>("ArenaAllocator",
+                                                          ArenaAllocator<long long>(arena), encher,
+                                                          alternar);
+  double liberacao = bench::medir([&] { arena.reset(); });
+  std::cout << "    (arena.reset: " << liberacao << " s)" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+  size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 21;
+
+  std::vector<long long> chaves(n);
+  bench::Aleatorio aleatorio;
+  for (long long& chave : chaves) chave = static_cast<long long>(aleatorio.proximo() % (4 * n));
+
+  std::cout << n << " elementos" << std::endl;
+
+  comparar<Fila>(
+      "Fila",
+      [&](auto& fila) {
+        for (long long chave : chaves) fila.push(chave);
+      },
+      [&](auto& fila) {
+        for (long long chave : chaves) {
+          fila.push(chave);
+          fila.pop();
+        }
+      });
+
+  comparar<Pilha>(
+      "Pilha",
+      [&](auto& pilha) {
+        for (long long chave : chaves) pilha.push(chave);
+      },
+      [&](auto& pilha) {
+        for (long long chave : chaves) {
+          pilha.push(chave);
+          pilha.pop();
+        }
+      });
+
+  comparar<Lista>(
+      "Lista",
+      [&](auto& lista) {
+        for (long long chave : chaves) lista.push_back(chave);
+      },
+      [&](auto& lista) {
+        for (long long chave : chaves) {
+          lista.push_back(chave);
+          lista.pop_front();
+        }
+      });
+
+  // A árvore já agrupa os nós em blocos; o alocador decide de onde vêm os blocos
+  comparar<BinSearchTree>(
+      "BinSearchTree",
+      [&](auto& arvore) {
+        for (long long chave : chaves) arvore.insert(chave);
+      },
+      [&](auto& arvore) {
+        for (size_t i = 0; i < n; ++i) {
+          arvore.remove(chaves[i]);
+          arvore.insert(chaves[n - 1 - i]);
+        }
+      });
+
+  return 0;
+}
@@ -0,0 +1,66 @@
+#include <cstdlib>
+#include <vector>
+
+#include "bench.hpp"
+#include "data-structures/AVLTree.hpp"
+#include "data-structures/BinSearchTree.hpp"
+
+/**
+ * @brief Insere, busca e remove as chaves na ordem dada e reporta o tempo de cada fase
+ *
+ */
+template <typename Arvore>
+void medir(const char* nome, const std::vector<int>& chaves) {
+  Arvore arvore;
+  size_t encontrados = 0;
+
+  double insercao = bench::medir([&] {
+    for (int chave : chaves) arvore.insert(chave);
+  });
+  size_t altura = arvore.height();
+
+  double busca = bench::medir([&] {
+    for (int chave : chaves) encontrados += arvore.search(chave);
+  });
+
+  double remocao = bench::medir([&] {
+    for (int chave : chaves) arvore.remove(chave);
+  });
+
+  bench::naoOtimizar(encontrados);
+  std::cout << "  " << nome << ": altura " << altura << ", insert " << insercao << " s, search "
+            << busca << " s, remove " << remocao << " s" << std::endl;
+}
+
+void comparar(const char* ordem, const std::vector<int>& chaves) {
+  std::cout << ordem << " (" << chaves.size() << " chaves)" << std::endl;
+  medir<BinSearchTree<int>>("BinSearchTree", chaves);
+  medir<AVLTree<int>>("AVLTree", chaves);
+}
+
+int main(int argc, char* argv[]) {
+  size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 20000;
+
+  std::vector<int> ordenadas(n);
+  for (size_t i = 0; i < n; ++i) ordenadas[i] = static_cast<int>(i);
+
+  std::vector<int> aleatorias = ordenadas;
+  bench::Aleatorio aleatorio;
+  for (size_t i = n; i > 1; --i) {
+    std::swap(aleatorias[i - 1], aleatorias[aleatorio.proximo() % i]);
+  }
+
+  // Adversária: alterna o menor e o maior valor restantes, formando um zigue-zague na árvore
+  // sem balanceamento
+  std::vector<int> zigueZague;
+  for (size_t esquerda = 0, direita = n; esquerda < direita;) {
+    zigueZague.push_back(static_cast<int>(esquerda++));
+    if (esquerda < direita) zigueZague.push_back(static_cast<int>(--direita));
+  }
+
+  comparar("Ordenadas", ordenadas);
+  comparar("Aleatorias", aleatorias);
+  comparar("Zigue-zague", zigueZague);
+
+  return 0;
+}
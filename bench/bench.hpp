@@ -0,0 +1,85 @@
+#ifndef BENCH_HPP
+#define BENCH_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Utilitários compartilhados pelos benchmarks da pasta `bench/`
+ *
+ */
+namespace bench {
+
+using Relogio = std::chrono::steady_clock;
+
+/**
+ * @brief Mede o tempo de execução (em segundos) de uma função
+ *
+ * @param funcao Função que será executada uma vez
+ * @return double
+ */
+template <typename Funcao>
+double medir(Funcao funcao) {
+  auto inicio = Relogio::now();
+  funcao();
+  auto fim = Relogio::now();
+  return std::chrono::duration<double>(fim - inicio).count();
+}
+
+/**
+ * @brief Imprime uma linha de resultado no formato "nome: valor unidade"
+ *
+ */
+inline void reportar(const std::string& nome, double valor, const std::string& unidade) {
+  std::cout << "  " << nome << ": " << valor << " " << unidade << std::endl;
+}
+
+/**
+ * @brief Retorna o percentil `p` (entre 0 e 1) de um conjunto de amostras
+ *
+ * @param amostras Amostras (são ordenadas pela função)
+ */
+template <typename Type>
+Type percentil(std::vector<Type>& amostras, double p) {
+  if (amostras.empty()) return Type();
+
+  std::sort(amostras.begin(), amostras.end());
+  size_t indice = static_cast<size_t>(p * (amostras.size() - 1));
+  return amostras[indice];
+}
+
+/**
+ * @brief Impede que o compilador descarte um valor calculado pelo benchmark
+ *
+ */
+template <typename Type>
+inline void naoOtimizar(const Type& valor) {
+  asm volatile("" : : "r,m"(valor) : "memory");
+}
+
+/**
+ * @brief Gerador pseudoaleatório simples (xorshift64) para os benchmarks
+ *
+ */
+class Aleatorio {
+ private:
+  uint64_t estado;
+
+ public:
+  explicit Aleatorio(uint64_t semente = 88172645463325252ull) : estado(semente) {}
+
+  uint64_t proximo() {
+    estado ^= estado << 13;
+    estado ^= estado >> 7;
+    estado ^= estado << 17;
+    return estado;
+  }
+};
+
+}  // namespace bench
+
+#endif
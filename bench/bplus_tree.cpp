@@ -0,0 +1,85 @@
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+#include "bench.hpp"
+#include "data-structures/BPlusTree.hpp"
+#include "data-structures/BinSearchTree.hpp"
+
+/**
+ * @brief Busca todas as consultas na árvore e reporta buscas por segundo e bytes por chave
+ *
+ */
+template <typename Arvore>
+void medirBuscas(const char* nome, const Arvore& arvore, const std::vector<long long>& consultas) {
+  size_t encontrados = 0;
+  double tempo = bench::medir([&] {
+    for (long long consulta : consultas) encontrados += arvore.search(consulta);
+  });
+  bench::naoOtimizar(encontrados);
+
+  std::cout << "  " << nome << ": " << consultas.size() / tempo << " buscas/s, "
+            << static_cast<double>(arvore.memoryUsage()) / arvore.countNodes()
+            << " bytes/chave, altura " << arvore.height() << std::endl;
+}
+
+/**
+ * @brief Compara `BinSearchTree` e `BPlusTree` em buscas aleatórias (metade das consultas não está
+ * na árvore) e em uma busca por intervalo.
+ *
+ */
+int main(int argc, char* argv[]) {
+  size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+
+  // Chaves pares em ordem aleatória (a BinSearchTree degeneraria com chaves ordenadas)
+  std::vector<long long> chaves(n);
+  for (size_t i = 0; i < n; ++i) chaves[i] = 2 * static_cast<long long>(i);
+
+  bench::Aleatorio aleatorio;
+  for (size_t i = n; i > 1; --i) {
+    std::swap(chaves[i - 1], chaves[aleatorio.proximo() % i]);
+  }
+
+  std::vector<long long> consultas(n);
+  for (size_t i = 0; i < n; ++i) consultas[i] = aleatorio.proximo() % (2 * n);
+
+  std::cout << n << " chaves long long" << std::endl;
+
+  BinSearchTree<long long> binaria;
+  BPlusTree<long long> bMais;
+  BPlusTree<long long> carregada;
+
+  bench::reportar("BinSearchTree insert",
+                  bench::medir([&] {
+                    for (long long chave : chaves) binaria.insert(chave);
+                  }),
+                  "s");
+  bench::reportar("BPlusTree insert",
+                  bench::medir([&] {
+                    for (long long chave : chaves) bMais.insert(chave);
+                  }),
+                  "s");
+
+  std::vector<long long> ordenadas = chaves;
+  std::sort(ordenadas.begin(), ordenadas.end());
+  bench::reportar("BPlusTree bulkLoad",
+                  bench::medir([&] { carregada.bulkLoad(ordenadas.begin(), ordenadas.end()); }),
+                  "s");
+
+  medirBuscas("BinSearchTree", binaria, consultas);
+  medirBuscas("BPlusTree (insert)", bMais, consultas);
+  medirBuscas("BPlusTree (bulkLoad)", carregada, consultas);
+
+  long long soma = 0;
+  size_t visitados = 0;
+  bench::reportar("BPlusTree range (10% das chaves)", bench::medir([&] {
+                    visitados = carregada.range(static_cast<long long>(n / 2),
+                                                static_cast<long long>(n / 2 + n / 5),
+                                                [&](long long chave) { soma += chave; });
+                  }),
+                  "s");
+  bench::naoOtimizar(soma);
+  bench::naoOtimizar(visitados);
+
+  return 0;
+}
@@ -0,0 +1,69 @@
+#include <cstdlib>
+#include <vector>
+
+#include "bench.hpp"
+#include "data-structures/BinSearchTree.hpp"
+
+/**
+ * @brief Compara um laço de `search` com `search_batch` em uma árvore bem maior que a cache,
+ * resolvendo as mesmas consultas em lotes de 8 a 1024 valores.
+ *
+ */
+int main(int argc, char* argv[]) {
+  size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 22;
+  size_t quantidadeConsultas = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1 << 20;
+
+  // Chaves em ordem aleatória, para que os nós fiquem espalhados pela memória
+  std::vector<long long> chaves(n);
+  for (size_t i = 0; i < n; ++i) chaves[i] = 2 * static_cast<long long>(i);
+
+  bench::Aleatorio aleatorio;
+  for (size_t i = n; i > 1; --i) {
+    std::swap(chaves[i - 1], chaves[aleatorio.proximo() % i]);
+  }
+
+  BinSearchTree<long long> arvore;
+  for (long long chave : chaves) arvore.insert(chave);
+
+  // Metade das consultas (as ímpares) não está na árvore
+  std::vector<long long> consultas(quantidadeConsultas);
+  for (long long& consulta : consultas) {
+    consulta = static_cast<long long>(aleatorio.proximo() % (2 * n));
+  }
+
+  std::cout << n << " chaves, " << quantidadeConsultas << " consultas (altura "
+            << arvore.height() << ")" << std::endl;
+
+  for (size_t tamanhoLote = 8; tamanhoLote <= 1024; tamanhoLote *= 2) {
+    std::vector<long long> lote(tamanhoLote);
+    std::vector<bool> resultados;
+    size_t encontradosLaco = 0;
+    size_t encontradosLote = 0;
+
+    double tempoLaco = bench::medir([&] {
+      for (size_t inicio = 0; inicio + tamanhoLote <= quantidadeConsultas; inicio += tamanhoLote) {
+        for (size_t i = 0; i < tamanhoLote; ++i) {
+          encontradosLaco += arvore.search(consultas[inicio + i]);
+        }
+      }
+    });
+
+    double tempoLote = bench::medir([&] {
+      for (size_t inicio = 0; inicio + tamanhoLote <= quantidadeConsultas; inicio += tamanhoLote) {
+        lote.assign(consultas.begin() + inicio, consultas.begin() + inicio + tamanhoLote);
+        arvore.search_batch(lote, resultados);
+        for (bool encontrado : resultados) encontradosLote += encontrado;
+      }
+    });
+
+    if (encontradosLaco != encontradosLote) {
+      std::cout << "  [FALHA] resultados diferentes para lotes de " << tamanhoLote << std::endl;
+    }
+
+    std::cout << "  lote " << tamanhoLote << ": search " << quantidadeConsultas / tempoLaco
+              << " buscas/s, search_batch " << quantidadeConsultas / tempoLote << " buscas/s"
+              << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,67 @@
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+#include "bench.hpp"
+#include "data-structures/BinSearchTree.hpp"
+
+/**
+ * @brief Mede as formas de (re)construir uma `BinSearchTree`: inserções uma a uma, carga a partir
+ * de valores ordenados (`buildFromSorted`) e cópia (construtor cópia), inclusive de uma árvore
+ * degenerada, em que a cópia antiga (reinserindo os valores) custava O(n²).
+ *
+ */
+int main(int argc, char* argv[]) {
+  size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+
+  std::vector<long long> chaves(n);
+  for (size_t i = 0; i < n; ++i) chaves[i] = static_cast<long long>(i);
+
+  std::vector<long long> embaralhadas = chaves;
+  bench::Aleatorio aleatorio;
+  for (size_t i = n; i > 1; --i) {
+    std::swap(embaralhadas[i - 1], embaralhadas[aleatorio.proximo() % i]);
+  }
+
+  std::cout << n << " chaves" << std::endl;
+
+  BinSearchTree<long long> aleatoria;
+  bench::reportar("insert (ordem aleatoria)", bench::medir([&] {
+                    for (long long chave : embaralhadas) aleatoria.insert(chave);
+                  }),
+                  "s");
+
+  BinSearchTree<long long> balanceada;
+  bench::reportar("buildFromSorted", bench::medir([&] {
+                    balanceada.buildFromSorted(chaves.begin(), chaves.end());
+                  }),
+                  "s");
+
+  BinSearchTree<long long>* copia = nullptr;
+  bench::reportar("copia (arvore aleatoria)",
+                  bench::medir([&] { copia = new BinSearchTree<long long>(aleatoria); }), "s");
+  bench::reportar("destrutor (copia)", bench::medir([&] { delete copia; }), "s");
+
+  // Árvore degenerada (uma lista para a direita). Montá-la já custa O(n²), então usa menos chaves
+  size_t m = std::min<size_t>(n, 20000);
+  BinSearchTree<long long> degenerada;
+  for (size_t i = 0; i < m; ++i) degenerada.insert(static_cast<long long>(i));
+
+  bench::reportar("copia (degenerada, " + std::to_string(m) + " nos)",
+                  bench::medir([&] { copia = new BinSearchTree<long long>(degenerada); }), "s");
+  delete copia;
+
+  size_t encontrados = 0;
+  double buscaAleatoria = bench::medir([&] {
+    for (long long chave : embaralhadas) encontrados += aleatoria.search(chave);
+  });
+  double buscaBalanceada = bench::medir([&] {
+    for (long long chave : embaralhadas) encontrados += balanceada.search(chave);
+  });
+  bench::naoOtimizar(encontrados);
+
+  bench::reportar("search (ordem aleatoria)", n / buscaAleatoria, "buscas/s");
+  bench::reportar("search (buildFromSorted)", n / buscaBalanceada, "buscas/s");
+
+  return 0;
+}
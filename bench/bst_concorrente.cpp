@@ -0,0 +1,175 @@
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "bench.hpp"
+#include "data-structures/BinSearchTree.hpp"
+#include "data-structures/BinSearchTreeConcorrente.hpp"
+
+/**
+ * @brief `BinSearchTree` protegida por um único mutex global, usada como referência
+ *
+ */
+class ArvoreComMutex {
+ private:
+  BinSearchTree<long long> arvore;
+  std::mutex trava;
+
+ public:
+  bool insert(long long valor) {
+    std::lock_guard<std::mutex> guarda(trava);
+    if (arvore.search(valor)) return false;
+    arvore.insert(valor);
+    return true;
+  }
+
+  bool remove(long long valor) {
+    std::lock_guard<std::mutex> guarda(trava);
+    return arvore.remove(valor);
+  }
+
+  bool search(long long valor) {
+    std::lock_guard<std::mutex> guarda(trava);
+    return arvore.search(valor);
+  }
+};
+
+/**
+ * @brief Carga mista com muitas leituras: 90% `search`, 5% `insert` e 5% `remove` de chaves
+ * aleatórias, divididas entre `threads` threads.
+ *
+ * @return double Milhões de operações por segundo
+ */
+template <typename Arvore>
+double cargaMista(Arvore& arvore, size_t chaves, size_t threads, size_t operacoes) {
+  size_t porThread = operacoes / threads;
+  size_t encontrados = 0;
+  std::mutex travaTotal;
+
+  double segundos = bench::medir([&] {
+    std::vector<std::thread> grupo;
+    for (size_t t = 0; t < threads; ++t) {
+      grupo.emplace_back([&, t] {
+        bench::Aleatorio aleatorio(t + 1);
+        size_t parcial = 0;
+
+        for (size_t i = 0; i < porThread; ++i) {
+          uint64_t sorteio = aleatorio.proximo();
+          long long chave = static_cast<long long>((sorteio >> 8) % (2 * chaves));
+
+          if (sorteio % 20 == 0) {
+            arvore.insert(chave);
+          } else if (sorteio % 20 == 1) {
+            arvore.remove(chave);
+          } else {
+            parcial += arvore.search(chave);
+          }
+        }
+
+        std::lock_guard<std::mutex> guarda(travaTotal);
+        encontrados += parcial;
+      });
+    }
+    for (std::thread& thread : grupo) thread.join();
+  });
+
+  bench::naoOtimizar(encontrados);
+  return porThread * threads / segundos / 1e6;
+}
+
+/**
+ * @brief Janela deslizante de chaves em ordem (como timestamps): um escritor insere a chave mais
+ * nova e remove a mais antiga, enquanto `leitores` threads buscam chaves da janela.
+ *
+ * Mostra a memória ocupada pelos nós antes e depois da rotatividade e a altura final, que devem
+ * continuar proporcionais à quantidade de chaves presentes.
+ */
+void rotatividade(size_t chaves, size_t leitores, size_t operacoes) {
+  BinSearchTreeConcorrente<long long> arvore;
+  for (size_t i = 0; i < chaves; ++i) arvore.insert(static_cast<long long>(i));
+  size_t memoriaInicial = arvore.memoryUsage();
+
+  std::atomic<long long> maisAntiga(0);
+  std::atomic<bool> terminou(false);
+  std::atomic<size_t> buscas(0);
+
+  double segundos = bench::medir([&] {
+    std::vector<std::thread> grupo;
+    for (size_t t = 0; t < leitores; ++t) {
+      grupo.emplace_back([&, t] {
+        bench::Aleatorio aleatorio(t + 1);
+        size_t parcial = 0;
+        size_t encontrados = 0;
+
+        while (!terminou.load(std::memory_order_relaxed)) {
+          long long chave = maisAntiga.load(std::memory_order_relaxed) +
+                            static_cast<long long>(aleatorio.proximo() % chaves);
+          encontrados += arvore.search(chave);
+          ++parcial;
+        }
+
+        bench::naoOtimizar(encontrados);
+        buscas.fetch_add(parcial, std::memory_order_relaxed);
+      });
+    }
+
+    for (size_t i = 0; i < operacoes; ++i) {
+      arvore.insert(static_cast<long long>(chaves + i));
+      arvore.remove(static_cast<long long>(i));
+      maisAntiga.store(static_cast<long long>(i + 1), std::memory_order_relaxed);
+    }
+
+    terminou.store(true, std::memory_order_relaxed);
+    for (std::thread& thread : grupo) thread.join();
+  });
+
+  std::cout << "  " << leitores << " leitores: " << 2 * operacoes / segundos / 1e6
+            << " Mops/s de escrita, " << buscas.load() / segundos / 1e6 << " Mops/s de leitura"
+            << std::endl;
+  std::cout << "    memoria dos nos: " << memoriaInicial / 1e6 << " MB antes, "
+            << arvore.memoryUsage() / 1e6 << " MB depois; altura " << arvore.height() << " ("
+            << arvore.size() << " chaves)" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+  size_t chaves = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+  size_t operacoes = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 2000000;
+
+  // Metade do intervalo de chaves é carregada antes, em ordem aleatória
+  std::vector<long long> iniciais(chaves);
+  for (size_t i = 0; i < chaves; ++i) iniciais[i] = 2 * static_cast<long long>(i);
+
+  bench::Aleatorio aleatorio;
+  for (size_t i = chaves; i > 1; --i) {
+    std::swap(iniciais[i - 1], iniciais[aleatorio.proximo() % i]);
+  }
+
+  std::cout << chaves << " chaves, " << operacoes
+            << " operacoes (90% search, 5% insert, 5% remove), em Mops/s" << std::endl;
+  std::cout << "  hardware: " << std::thread::hardware_concurrency() << " threads" << std::endl;
+
+  for (size_t threads = 1; threads <= 64; threads *= 2) {
+    ArvoreComMutex comMutex;
+    BinSearchTreeConcorrente<long long> concorrente;
+    for (long long chave : iniciais) {
+      comMutex.insert(chave);
+      concorrente.insert(chave);
+    }
+
+    double mutex = cargaMista(comMutex, chaves, threads, operacoes);
+    double semTravas = cargaMista(concorrente, chaves, threads, operacoes);
+
+    std::cout << "  " << threads << " threads: mutex global " << mutex
+              << ", BinSearchTreeConcorrente " << semTravas << std::endl;
+  }
+
+  std::cout << "rotatividade com chaves em ordem: " << chaves << " chaves na janela, " << operacoes
+            << " insercoes e " << operacoes << " remocoes" << std::endl;
+  for (size_t leitores = 0; leitores <= 4; leitores = leitores == 0 ? 1 : 2 * leitores) {
+    rotatividade(chaves, leitores, operacoes);
+  }
+
+  return 0;
+}
@@ -0,0 +1,61 @@
+#include <cstdlib>
+#include <fstream>
+
+#include "bench.hpp"
+#include "data-structures/BinSearchTree.hpp"
+
+/**
+ * @brief Carrega chaves ordenadas na `BinSearchTree`, o que gera uma árvore degenerada (uma lista)
+ * com altura igual ao número de nós, e executa todas as operações que antes eram recursivas.
+ *
+ * Observação: em uma árvore degenerada cada inserção percorre a árvore inteira, então carregar N
+ * chaves ordenadas custa O(N²). O objetivo aqui é mostrar que a profundidade não derruba mais o
+ * processo; para 10M de chaves use `bench_bst_iterativo 10000000` e tenha paciência.
+ */
+int main(int argc, char* argv[]) {
+  size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 50000;
+
+  // Os percursos imprimem os valores; a saída é descartada para medir só o percurso
+  std::ofstream descarte("/dev/null");
+  std::streambuf* saidaOriginal = std::cout.rdbuf();
+
+  std::cout << "BinSearchTree com " << n << " chaves ordenadas" << std::endl;
+
+  BinSearchTree<long long>* arvore = new BinSearchTree<long long>();
+
+  bench::reportar("insert", bench::medir([&] {
+                    for (size_t i = 0; i < n; ++i) arvore->insert(static_cast<long long>(i));
+                  }),
+                  "s");
+
+  bool encontrado = false;
+  bench::reportar("search (ultima chave)",
+                  bench::medir([&] { encontrado = arvore->search(static_cast<long long>(n - 1)); }),
+                  "s");
+  bench::naoOtimizar(encontrado);
+
+  size_t resultado = 0;
+  bench::reportar("height", bench::medir([&] { resultado = arvore->height(); }), "s");
+  bench::reportar("countNodes", bench::medir([&] { resultado += arvore->countNodes(); }), "s");
+  bench::reportar("isBalanced", bench::medir([&] { resultado += arvore->isBalanced(); }), "s");
+  bench::naoOtimizar(resultado);
+
+  std::cout.rdbuf(descarte.rdbuf());
+  double preOrdem = bench::medir([&] { arvore->preOrder(); });
+  double emOrdem = bench::medir([&] { arvore->inOrder(); });
+  double posOrdem = bench::medir([&] { arvore->postOrder(); });
+  std::cout.rdbuf(saidaOriginal);
+
+  bench::reportar("preOrder", preOrdem, "s");
+  bench::reportar("inOrder", emOrdem, "s");
+  bench::reportar("postOrder", posOrdem, "s");
+
+  BinSearchTree<long long>* copia = nullptr;
+  bench::reportar("copia", bench::medir([&] { copia = new BinSearchTree<long long>(*arvore); }),
+                  "s");
+
+  bench::reportar("destrutor", bench::medir([&] { delete arvore; }), "s");
+  delete copia;
+
+  return 0;
+}
@@ -0,0 +1,82 @@
+#include <atomic>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "algorithms/WorkStealingPool.hpp"
+#include "bench.hpp"
+#include "data-structures/BinSearchTree.hpp"
+
+/**
+ * @brief Mede a escalabilidade da cópia, do `clear`, do `for_each` e do `reduce` paralelos de
+ * `BinSearchTree` com 1, 2, 4, ... threads, comparando com as versões sequenciais.
+ *
+ */
+int main(int argc, char* argv[]) {
+  size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 21;
+  size_t maximoThreads = argc > 2 ? std::strtoull(argv[2], nullptr, 10)
+                                  : std::max(1u, std::thread::hardware_concurrency());
+
+  bench::Aleatorio aleatorio;
+  BinSearchTree<long long> arvore;
+  for (size_t i = 0; i < n; ++i) {
+    arvore.insert(static_cast<long long>(aleatorio.proximo() % (4 * n)));
+  }
+
+  // Valores com destrutor não trivial, para que a destruição precise percorrer os nós
+  BinSearchTree<std::string> textos;
+  for (size_t i = 0; i < n / 4; ++i) {
+    textos.insert(std::string(24, 'x') + std::to_string(aleatorio.proximo()));
+  }
+
+  std::cout << n << " chaves (altura " << arvore.height() << ")" << std::endl;
+
+  long long somaSequencial = 0;
+  double tempoCopia = bench::medir([&] { BinSearchTree<long long> copia(arvore); });
+  double tempoClear = bench::medir([&] {
+    BinSearchTree<std::string> copia(textos);
+    copia.clear();
+  });
+  double tempoSoma = bench::medir([&] {
+    for (long long valor : arvore) somaSequencial += valor;
+  });
+
+  std::cout << "sequencial" << std::endl;
+  bench::reportar("copia", tempoCopia * 1000, "ms");
+  bench::reportar("copia + clear (strings)", tempoClear * 1000, "ms");
+  bench::reportar("soma", tempoSoma * 1000, "ms");
+
+  for (size_t threads = 1; threads <= maximoThreads; threads *= 2) {
+    WorkStealingPool pool(threads);
+
+    tempoCopia = bench::medir([&] { BinSearchTree<long long> copia(arvore, pool); });
+    tempoClear = bench::medir([&] {
+      BinSearchTree<std::string> copia(textos, pool);
+      copia.clear(pool);
+    });
+
+    std::atomic<size_t> visitados(0);
+    double tempoForEach = bench::medir([&] {
+      arvore.for_each([&](const long long&) { visitados.fetch_add(1, std::memory_order_relaxed); },
+                      pool);
+    });
+
+    long long soma = 0;
+    tempoSoma = bench::medir([&] {
+      soma = arvore.reduce(0LL, [](long long a, long long b) { return a + b; }, pool);
+    });
+
+    if (soma != somaSequencial || visitados != n) {
+      std::cout << "  [FALHA] resultados diferentes com " << threads << " threads" << std::endl;
+    }
+
+    std::cout << threads << " threads" << std::endl;
+    bench::reportar("copia", tempoCopia * 1000, "ms");
+    bench::reportar("copia + clear (strings)", tempoClear * 1000, "ms");
+    bench::reportar("for_each", tempoForEach * 1000, "ms");
+    bench::reportar("reduce (soma)", tempoSoma * 1000, "ms");
+  }
+
+  return 0;
+}
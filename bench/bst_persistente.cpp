@@ -0,0 +1,75 @@
+#include <cstdlib>
+#include <vector>
+
+#include "bench.hpp"
+#include "data-structures/AVLTree.hpp"
+#include "data-structures/BinSearchTree.hpp"
+#include "data-structures/BinSearchTreePersistente.hpp"
+
+/**
+ * @brief Compara o custo de obter uma visão consistente da árvore (cópia da `BinSearchTree` contra
+ * `snapshot()` da árvore persistente) e o custo extra da cópia de caminho em `insert`/`remove`.
+ *
+ */
+int main(int argc, char* argv[]) {
+  size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+  size_t alteracoes = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 200000;
+
+  std::vector<long long> chaves(n);
+  for (size_t i = 0; i < n; ++i) chaves[i] = static_cast<long long>(i);
+
+  bench::Aleatorio aleatorio;
+  for (size_t i = n; i > 1; --i) {
+    std::swap(chaves[i - 1], chaves[aleatorio.proximo() % i]);
+  }
+
+  std::cout << n << " chaves" << std::endl;
+
+  BinSearchTree<long long> arvore;
+  AVLTree<long long> avl;
+  BinSearchTreePersistente<long long> persistente;
+
+  bench::reportar("BinSearchTree insert", bench::medir([&] {
+                    for (long long chave : chaves) arvore.insert(chave);
+                  }),
+                  "s");
+  bench::reportar("AVLTree insert", bench::medir([&] {
+                    for (long long chave : chaves) avl.insert(chave);
+                  }),
+                  "s");
+  bench::reportar("BinSearchTreePersistente insert", bench::medir([&] {
+                    for (long long chave : chaves) persistente.insert(chave);
+                  }),
+                  "s");
+
+  BinSearchTree<long long>* copia = nullptr;
+  bench::reportar("BinSearchTree copia",
+                  bench::medir([&] { copia = new BinSearchTree<long long>(arvore); }), "s");
+  delete copia;
+
+  BinSearchTreePersistente<long long>* versao = nullptr;
+  bench::reportar("BinSearchTreePersistente snapshot", bench::medir([&] {
+                    versao = new BinSearchTreePersistente<long long>(persistente.snapshot());
+                  }),
+                  "s");
+
+  // Alterações com a versão antiga viva: cada uma copia só o caminho alterado
+  bench::reportar("remove + insert com snapshot vivo", bench::medir([&] {
+                    for (size_t i = 0; i < alteracoes; ++i) {
+                      long long chave = chaves[i % n];
+                      persistente.remove(chave);
+                      persistente.insert(chave + static_cast<long long>(n));
+                    }
+                  }) / alteracoes * 1e9,
+                  "ns/par");
+
+  size_t encontrados = 0;
+  for (size_t i = 0; i < alteracoes; ++i) encontrados += versao->search(chaves[i % n]);
+  if (encontrados != alteracoes || versao->countNodes() != n) {
+    std::cout << "  [FALHA] o snapshot foi alterado" << std::endl;
+  }
+
+  bench::reportar("liberar snapshot", bench::medir([&] { delete versao; }), "s");
+
+  return 0;
+}
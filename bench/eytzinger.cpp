@@ -0,0 +1,56 @@
+#include <cstdlib>
+#include <vector>
+
+#include "bench.hpp"
+#include "data-structures/BinSearchTree.hpp"
+#include "data-structures/EytzingerTree.hpp"
+
+/**
+ * @brief Compara `BinSearchTree::search` com a busca na cópia congelada (`freeze`) para uma árvore
+ * com `n` chaves inseridas em ordem aleatória.
+ *
+ */
+void comparar(size_t n, size_t quantidadeConsultas) {
+  std::vector<int> chaves(n);
+  for (size_t i = 0; i < n; ++i) chaves[i] = 2 * static_cast<int>(i);
+
+  bench::Aleatorio aleatorio(n);
+  for (size_t i = n; i > 1; --i) {
+    std::swap(chaves[i - 1], chaves[aleatorio.proximo() % i]);
+  }
+
+  // Metade das consultas (as ímpares) não está na árvore
+  std::vector<int> consultas(quantidadeConsultas);
+  for (int& consulta : consultas) consulta = static_cast<int>(aleatorio.proximo() % (2 * n));
+
+  BinSearchTree<int> arvore;
+  for (int chave : chaves) arvore.insert(chave);
+
+  EytzingerTree<int> congelada;
+  double congelamento = bench::medir([&] { congelada = arvore.freeze(); });
+
+  size_t encontrados = 0;
+  double tempoArvore = bench::medir([&] {
+    for (int consulta : consultas) encontrados += arvore.search(consulta);
+  });
+  double tempoCongelada = bench::medir([&] {
+    for (int consulta : consultas) encontrados += congelada.search(consulta);
+  });
+  bench::naoOtimizar(encontrados);
+
+  std::cout << n << " chaves (" << arvore.memoryUsage() / 1024 << " KiB na BinSearchTree, "
+            << congelada.memoryUsage() / 1024 << " KiB congelada)" << std::endl;
+  bench::reportar("freeze", congelamento, "s");
+  bench::reportar("BinSearchTree", quantidadeConsultas / tempoArvore, "buscas/s");
+  bench::reportar("EytzingerTree", quantidadeConsultas / tempoCongelada, "buscas/s");
+}
+
+int main(int argc, char* argv[]) {
+  size_t consultas = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000000;
+
+  comparar(1 << 10, consultas);  // Cabe na cache L1
+  comparar(1 << 16, consultas);  // Cabe na cache L2/L3
+  comparar(1 << 22, consultas);  // Bem maior que a cache
+
+  return 0;
+}
@@ -0,0 +1,50 @@
+#include <cstdlib>
+
+#include "bench.hpp"
+#include "data-structures/Fila.hpp"
+#include "data-structures/FilaBlocos.hpp"
+
+/**
+ * @brief Compara a `Fila` de nós ligados com a `FilaBlocos`
+ *
+ * Dois cenários: enchimento seguido de esvaziamento (rajada) e fila de tamanho estável, onde cada
+ * `push` é seguido de um `pop`.
+ */
+template <typename FilaTipo>
+void medirFila(const char* nome, size_t operacoes, size_t profundidade) {
+  std::cout << nome << std::endl;
+
+  FilaTipo fila;
+  long long soma = 0;
+
+  double rajada = bench::medir([&] {
+    for (size_t i = 0; i < operacoes; ++i) fila.push(static_cast<int>(i));
+    while (!fila.isEmpty()) {
+      soma += fila.front();
+      fila.pop();
+    }
+  });
+  bench::reportar("rajada", 2.0 * operacoes / rajada / 1e6, "Mops/s");
+
+  for (size_t i = 0; i < profundidade; ++i) fila.push(static_cast<int>(i));
+  double estavel = bench::medir([&] {
+    for (size_t i = 0; i < operacoes; ++i) {
+      fila.push(static_cast<int>(i));
+      soma += fila.front();
+      fila.pop();
+    }
+  });
+  bench::reportar("estavel", 2.0 * operacoes / estavel / 1e6, "Mops/s");
+
+  bench::naoOtimizar(soma);
+}
+
+int main(int argc, char* argv[]) {
+  size_t operacoes = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+
+  medirFila<Fila<int>>("Fila (nos ligados)", operacoes, 1000);
+  medirFila<FilaBlocos<int>>("FilaBlocos<int, 64>", operacoes, 1000);
+  medirFila<FilaBlocos<int, 1024>>("FilaBlocos<int, 1024>", operacoes, 1000);
+
+  return 0;
+}
@@ -0,0 +1,95 @@
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+
+#include "bench.hpp"
+#include "data-structures/Fila.hpp"
+#include "data-structures/FilaBloqueante.hpp"
+
+long long agoraNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             bench::Relogio::now().time_since_epoch())
+      .count();
+}
+
+/**
+ * @brief Consumidor que consulta `Fila::isEmpty()` e dorme entre as consultas, como é feito hoje
+ *
+ */
+class FilaComSondagem {
+ private:
+  Fila<long long> fila;
+  std::mutex trava;
+  std::chrono::microseconds intervalo;
+
+ public:
+  explicit FilaComSondagem(std::chrono::microseconds intervalo) : intervalo(intervalo) {}
+
+  void push(long long dado) {
+    std::lock_guard<std::mutex> guarda(trava);
+    fila.push(dado);
+  }
+
+  bool pop_wait(long long& saida) {
+    while (true) {
+      {
+        std::lock_guard<std::mutex> guarda(trava);
+        if (!fila.isEmpty()) {
+          saida = fila.front();
+          fila.pop();
+          return true;
+        }
+      }
+      std::this_thread::sleep_for(intervalo);
+    }
+  }
+};
+
+/**
+ * @brief Mede a latência de entrega de um item isolado, do `push` até o consumidor recebê-lo
+ *
+ * Entre dois envios o produtor espera `pausa`, tempo suficiente para o consumidor voltar a dormir.
+ */
+template <typename FilaTipo>
+void latencia(const char* nome, FilaTipo& fila, size_t total, std::chrono::microseconds pausa) {
+  std::vector<long long> amostras;
+  amostras.reserve(total);
+
+  std::thread consumidor([&] {
+    long long enviado;
+    while (amostras.size() < total && fila.pop_wait(enviado)) {
+      amostras.push_back(agoraNs() - enviado);
+    }
+  });
+
+  for (size_t i = 0; i < total; ++i) {
+    fila.push(agoraNs());
+    std::this_thread::sleep_for(pausa);
+  }
+
+  consumidor.join();
+
+  std::cout << nome << ": p50 = " << bench::percentil(amostras, 0.50) / 1000.0
+            << " us, p99 = " << bench::percentil(amostras, 0.99) / 1000.0 << " us" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+  size_t total = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 5000;
+  std::chrono::microseconds pausa(200);
+
+  std::cout << "Latencia de entrega (" << total << " itens isolados)" << std::endl;
+  {
+    FilaComSondagem fila(std::chrono::microseconds(1000));
+    latencia("Fila + sleep 1ms", fila, total, pausa);
+  }
+  {
+    FilaComSondagem fila(std::chrono::microseconds(50));
+    latencia("Fila + sleep 50us", fila, total, pausa);
+  }
+  {
+    FilaBloqueante<long long> fila;
+    latencia("FilaBloqueante", fila, total, pausa);
+  }
+
+  return 0;
+}
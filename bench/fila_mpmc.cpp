@@ -0,0 +1,143 @@
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+
+#include "bench.hpp"
+#include "data-structures/Fila.hpp"
+#include "data-structures/FilaMPMC.hpp"
+
+/**
+ * @brief `Fila` serializada por uma única trava, como é usada hoje entre várias threads
+ *
+ */
+class FilaComMutex {
+ private:
+  Fila<long long> fila;
+  std::mutex trava;
+
+ public:
+  bool try_push(long long dado) {
+    std::lock_guard<std::mutex> guarda(trava);
+    fila.push(dado);
+    return true;
+  }
+
+  bool try_pop(long long& saida) {
+    std::lock_guard<std::mutex> guarda(trava);
+    if (fila.isEmpty()) return false;
+    saida = fila.front();
+    fila.pop();
+    return true;
+  }
+
+  size_t push_n(const long long* dados, size_t quantidade) {
+    std::lock_guard<std::mutex> guarda(trava);
+    for (size_t i = 0; i < quantidade; ++i) fila.push(dados[i]);
+    return quantidade;
+  }
+
+  size_t pop_n(long long* saida, size_t quantidade) {
+    std::lock_guard<std::mutex> guarda(trava);
+    size_t i = 0;
+    for (; i < quantidade && !fila.isEmpty(); ++i) {
+      saida[i] = fila.front();
+      fila.pop();
+    }
+    return i;
+  }
+};
+
+/**
+ * @brief `threads` produtores enviam `porProdutor` elementos cada para `threads` consumidores
+ *
+ * Com `lote` igual a 1 são usados `try_push`/`try_pop`; caso contrário `push_n`/`pop_n`.
+ *
+ * @return double Milhões de elementos transferidos por segundo
+ */
+template <typename FilaTipo>
+double vazao(FilaTipo& fila, size_t threads, size_t porProdutor, size_t lote) {
+  size_t total = threads * porProdutor;
+  std::atomic<size_t> recebidos(0);
+  std::atomic<long long> soma(0);
+
+  double segundos = bench::medir([&] {
+    std::vector<std::thread> grupo;
+
+    for (size_t t = 0; t < threads; ++t) {
+      grupo.emplace_back([&] {
+        std::vector<long long> buffer(lote);
+        long long parcial = 0;
+
+        while (recebidos.load(std::memory_order_relaxed) < total) {
+          size_t n = 0;
+          if (lote == 1) {
+            n = fila.try_pop(buffer[0]) ? 1 : 0;
+          } else {
+            n = fila.pop_n(buffer.data(), lote);
+          }
+
+          if (n == 0) {
+            std::this_thread::yield();
+            continue;
+          }
+          for (size_t i = 0; i < n; ++i) parcial += buffer[i];
+          recebidos.fetch_add(n, std::memory_order_relaxed);
+        }
+
+        soma.fetch_add(parcial);
+      });
+    }
+
+    for (size_t t = 0; t < threads; ++t) {
+      grupo.emplace_back([&, t] {
+        std::vector<long long> buffer(lote);
+        for (size_t enviados = 0; enviados < porProdutor;) {
+          size_t n = std::min(lote, porProdutor - enviados);
+          for (size_t i = 0; i < n; ++i) {
+            buffer[i] = static_cast<long long>(t * porProdutor + enviados + i);
+          }
+
+          size_t aceitos =
+              lote == 1 ? (fila.try_push(buffer[0]) ? 1 : 0) : fila.push_n(buffer.data(), n);
+          if (aceitos == 0) std::this_thread::yield();
+          enviados += aceitos;
+        }
+      });
+    }
+
+    for (std::thread& thread : grupo) thread.join();
+  });
+
+  bench::naoOtimizar(soma.load());
+  return total / segundos / 1e6;
+}
+
+int main(int argc, char* argv[]) {
+  size_t porProdutor = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000000;
+  size_t maximo = argc > 2 ? std::strtoull(argv[2], nullptr, 10)
+                           : std::max(4u, std::thread::hardware_concurrency() / 2);
+
+  std::cout << "Vazao (Mops/s) com N produtores e N consumidores" << std::endl;
+  for (size_t threads = 1; threads <= maximo; threads *= 2) {
+    std::cout << "N = " << threads << std::endl;
+    {
+      FilaComMutex fila;
+      bench::reportar("Fila + mutex", vazao(fila, threads, porProdutor, 1), "Mops/s");
+    }
+    {
+      FilaComMutex fila;
+      bench::reportar("Fila + mutex (lote 32)", vazao(fila, threads, porProdutor, 32), "Mops/s");
+    }
+    {
+      FilaMPMC<long long> fila(1 << 14);
+      bench::reportar("FilaMPMC", vazao(fila, threads, porProdutor, 1), "Mops/s");
+    }
+    {
+      FilaMPMC<long long> fila(1 << 14);
+      bench::reportar("FilaMPMC (lote 32)", vazao(fila, threads, porProdutor, 32), "Mops/s");
+    }
+  }
+
+  return 0;
+}
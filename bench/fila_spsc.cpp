@@ -0,0 +1,170 @@
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+
+#include "bench.hpp"
+#include "data-structures/Fila.hpp"
+#include "data-structures/FilaSPSC.hpp"
+
+/**
+ * @brief `Fila` protegida por um mutex externo, como é usada hoje entre duas threads
+ *
+ */
+class FilaComMutex {
+ private:
+  Fila<long long> fila;
+  std::mutex trava;
+
+ public:
+  bool try_push(long long dado) {
+    std::lock_guard<std::mutex> guarda(trava);
+    fila.push(dado);
+    return true;
+  }
+
+  bool try_pop(long long& saida) {
+    std::lock_guard<std::mutex> guarda(trava);
+    if (fila.isEmpty()) return false;
+    saida = fila.front();
+    fila.pop();
+    return true;
+  }
+};
+
+long long agoraNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             bench::Relogio::now().time_since_epoch())
+      .count();
+}
+
+/**
+ * @brief Um produtor envia `total` elementos para um consumidor e mede a vazão
+ *
+ */
+template <typename FilaTipo>
+double vazao(FilaTipo& fila, size_t total) {
+  long long soma = 0;
+
+  double segundos = bench::medir([&] {
+    std::thread consumidor([&] {
+      long long valor;
+      for (size_t recebidos = 0; recebidos < total;) {
+        if (fila.try_pop(valor)) {
+          soma += valor;
+          ++recebidos;
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+
+    for (size_t i = 0; i < total; ++i) {
+      while (!fila.try_push(static_cast<long long>(i))) std::this_thread::yield();
+    }
+
+    consumidor.join();
+  });
+
+  bench::naoOtimizar(soma);
+  return total / segundos / 1e6;
+}
+
+/**
+ * @brief Vazão usando `push_n`/`pop_n` em lotes de `lote` elementos
+ *
+ */
+double vazaoEmLote(FilaSPSC<long long>& fila, size_t total, size_t lote) {
+  long long soma = 0;
+
+  double segundos = bench::medir([&] {
+    std::thread consumidor([&] {
+      std::vector<long long> buffer(lote);
+      for (size_t recebidos = 0; recebidos < total;) {
+        size_t n = fila.pop_n(buffer.data(), lote);
+        if (n == 0) std::this_thread::yield();
+        for (size_t i = 0; i < n; ++i) soma += buffer[i];
+        recebidos += n;
+      }
+    });
+
+    std::vector<long long> buffer(lote);
+    for (size_t enviados = 0; enviados < total;) {
+      size_t n = std::min(lote, total - enviados);
+      for (size_t i = 0; i < n; ++i) buffer[i] = static_cast<long long>(enviados + i);
+      size_t aceitos = fila.push_n(buffer.data(), n);
+      if (aceitos == 0) std::this_thread::yield();
+      enviados += aceitos;
+    }
+
+    consumidor.join();
+  });
+
+  bench::naoOtimizar(soma);
+  return total / segundos / 1e6;
+}
+
+/**
+ * @brief Mede a latência de entrega: o produtor envia o instante do envio e o consumidor calcula
+ * quanto tempo o elemento levou para atravessar a fila
+ *
+ */
+template <typename FilaTipo>
+void latencia(const char* nome, FilaTipo& fila, size_t total) {
+  std::vector<long long> amostras;
+  amostras.reserve(total);
+
+  std::thread consumidor([&] {
+    long long enviado;
+    while (amostras.size() < total) {
+      if (fila.try_pop(enviado)) {
+        amostras.push_back(agoraNs() - enviado);
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  for (size_t i = 0; i < total; ++i) {
+    while (!fila.try_push(agoraNs())) std::this_thread::yield();
+
+    // Espaça os envios para medir a latência de um elemento isolado, e não a de uma fila cheia
+    long long espera = agoraNs() + 2000;
+    while (agoraNs() < espera) {
+    }
+  }
+
+  consumidor.join();
+
+  std::cout << nome << " latencia: p50 = " << bench::percentil(amostras, 0.50)
+            << " ns, p99 = " << bench::percentil(amostras, 0.99) << " ns" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+  size_t total = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 20000000;
+  size_t amostras = 20000;
+
+  std::cout << "Vazao com 2 threads (" << total << " elementos)" << std::endl;
+  {
+    FilaComMutex fila;
+    bench::reportar("Fila + mutex", vazao(fila, total), "Mops/s");
+  }
+  {
+    FilaSPSC<long long> fila(1 << 14);
+    bench::reportar("FilaSPSC try_push/try_pop", vazao(fila, total), "Mops/s");
+  }
+  {
+    FilaSPSC<long long> fila(1 << 14);
+    bench::reportar("FilaSPSC push_n/pop_n (lote 64)", vazaoEmLote(fila, total, 64), "Mops/s");
+  }
+
+  {
+    FilaComMutex fila;
+    latencia("Fila + mutex", fila, amostras);
+  }
+  {
+    FilaSPSC<long long> fila(1 << 14);
+    latencia("FilaSPSC", fila, amostras);
+  }
+
+  return 0;
+}
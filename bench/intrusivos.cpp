@@ -0,0 +1,138 @@
+#include <cstdlib>
+#include <vector>
+
+#include "bench.hpp"
+#include "data-structures/Fila.hpp"
+#include "data-structures/FilaIntrusiva.hpp"
+#include "data-structures/ListaDupla.hpp"
+#include "data-structures/ListaIntrusiva.hpp"
+#include "data-structures/Pilha.hpp"
+#include "data-structures/PilhaIntrusiva.hpp"
+
+struct Recentes {};
+
+/**
+ * @brief Objeto de 64 bytes que já vive em um pool (o vetor do benchmark)
+ *
+ */
+struct Tarefa : Gancho<>, Gancho<Recentes> {
+  long long id;
+  long long carga[3];
+};
+
+/**
+ * @brief Passa todas as tarefas pela fila `voltas` vezes (cada tarefa entra e sai uma vez por
+ * volta, com até `janela` tarefas na fila)
+ *
+ */
+template <typename Entrar, typename Sair>
+void medirFila(const char* nome, std::vector<Tarefa>& tarefas, size_t voltas, size_t janela,
+               Entrar entrar, Sair sair) {
+  long long soma = 0;
+  double tempo = bench::medir([&] {
+    for (size_t volta = 0; volta < voltas; ++volta) {
+      for (size_t i = 0; i < tarefas.size(); ++i) {
+        entrar(tarefas[i]);
+        if (i >= janela) soma += sair();
+      }
+      for (size_t i = 0; i < janela; ++i) soma += sair();
+    }
+  });
+  bench::naoOtimizar(soma);
+  bench::reportar(nome, 2.0 * voltas * tarefas.size() / tempo, "ops/s");
+}
+
+int main(int argc, char* argv[]) {
+  size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 20;
+  size_t voltas = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 10;
+  size_t janela = 1024;
+
+  std::vector<Tarefa> tarefas(n);
+  for (size_t i = 0; i < n; ++i) tarefas[i].id = static_cast<long long>(i);
+
+  std::cout << n << " tarefas de " << sizeof(Tarefa) << " bytes" << std::endl;
+
+  std::cout << "Fila" << std::endl;
+  {
+    Fila<Tarefa> fila;
+    medirFila("Fila<Tarefa> (copia)", tarefas, voltas, janela, [&](Tarefa& t) { fila.push(t); },
+              [&] {
+                long long id = fila.front().id;
+                fila.pop();
+                return id;
+              });
+  }
+  {
+    Fila<Tarefa*> fila;
+    medirFila("Fila<Tarefa*>", tarefas, voltas, janela, [&](Tarefa& t) { fila.push(&t); },
+              [&] {
+                long long id = fila.front()->id;
+                fila.pop();
+                return id;
+              });
+  }
+  {
+    FilaIntrusiva<Tarefa> fila;
+    medirFila("FilaIntrusiva<Tarefa>", tarefas, voltas, janela, [&](Tarefa& t) { fila.push(t); },
+              [&] {
+                long long id = fila.front().id;
+                fila.pop();
+                return id;
+              });
+  }
+
+  std::cout << "Pilha" << std::endl;
+  {
+    Pilha<Tarefa*> pilha;
+    medirFila("Pilha<Tarefa*>", tarefas, voltas, janela, [&](Tarefa& t) { pilha.push(&t); },
+              [&] {
+                long long id = pilha.top()->id;
+                pilha.pop();
+                return id;
+              });
+  }
+  {
+    PilhaIntrusiva<Tarefa> pilha;
+    medirFila("PilhaIntrusiva<Tarefa>", tarefas, voltas, janela,
+              [&](Tarefa& t) { pilha.push(t); },
+              [&] {
+                long long id = pilha.top().id;
+                pilha.pop();
+                return id;
+              });
+  }
+
+  // Lista de recência: cada acesso tira a tarefa do meio da lista e a religa no final
+  std::cout << "Lista (tarefa acessada vai para o final)" << std::endl;
+  bench::Aleatorio aleatorio;
+  std::vector<size_t> acessos(voltas * n / 4);
+  for (size_t& acesso : acessos) acesso = aleatorio.proximo() % n;
+
+  {
+    ListaDupla<Tarefa*> lista;
+    std::vector<ListaDupla<Tarefa*>::iterator> handles(n);
+    for (size_t i = 0; i < n; ++i) handles[i] = lista.insert(lista.end(), &tarefas[i]);
+
+    double tempo = bench::medir([&] {
+      for (size_t acesso : acessos) {
+        lista.erase(handles[acesso]);
+        handles[acesso] = lista.insert(lista.end(), &tarefas[acesso]);
+      }
+    });
+    bench::reportar("ListaDupla<Tarefa*> (erase + insert)", acessos.size() / tempo, "ops/s");
+  }
+  {
+    ListaIntrusiva<Tarefa, Recentes> lista;
+    for (Tarefa& tarefa : tarefas) lista.push_back(tarefa);
+
+    double tempo = bench::medir([&] {
+      for (size_t acesso : acessos) {
+        lista.erase(tarefas[acesso]);
+        lista.push_back(tarefas[acesso]);
+      }
+    });
+    bench::reportar("ListaIntrusiva<Tarefa>", acessos.size() / tempo, "ops/s");
+  }
+
+  return 0;
+}
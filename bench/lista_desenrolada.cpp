@@ -0,0 +1,97 @@
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+#include "allocators/PoolAllocator.hpp"
+#include "bench.hpp"
+#include "data-structures/Lista.hpp"
+#include "data-structures/ListaDesenrolada.hpp"
+
+/**
+ * @brief Percorre a lista `voltas` vezes e reporta a banda (bytes de elementos lidos por segundo)
+ * e os bytes ocupados por elemento
+ *
+ */
+template <typename ListaTipo>
+void medirPercurso(const char* nome, const ListaTipo& lista, size_t voltas) {
+  long long soma = 0;
+  double tempo = bench::medir([&] {
+    for (size_t volta = 0; volta < voltas; ++volta) {
+      for (long long valor : lista) soma += valor;
+    }
+  });
+  bench::naoOtimizar(soma);
+
+  double bytes = static_cast<double>(lista.size() * voltas * sizeof(long long));
+  std::cout << "  " << nome << ": " << bytes / tempo / 1e9 << " GB/s, "
+            << static_cast<double>(lista.memoryUsage()) / lista.size() << " bytes/elemento"
+            << std::endl;
+}
+
+/**
+ * @brief Insere e remove no meio da lista, onde a busca pela posição domina o custo
+ *
+ */
+template <typename ListaTipo>
+void medirMeio(const char* nome, ListaTipo& lista, size_t operacoes) {
+  double tempo = bench::medir([&] {
+    for (size_t i = 0; i < operacoes; ++i) {
+      lista.insert(static_cast<long long>(i), lista.size() / 2);
+      lista.remove(lista.size() / 3);
+    }
+  });
+  bench::reportar(nome, 2.0 * operacoes / tempo, "ops/s");
+}
+
+int main(int argc, char* argv[]) {
+  size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 22;
+  size_t voltas = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 10;
+  size_t operacoes = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 2000;
+
+  std::cout << n << " elementos de " << sizeof(long long) << " bytes" << std::endl;
+
+  // Nós alocados em sequência ficam vizinhos na memória, o melhor caso para a lista ligada
+  Lista<long long> sequencial;
+  for (size_t i = 0; i < n; ++i) sequencial.push_back(static_cast<long long>(i));
+
+  // Para espalhar os nós, a lista livre do conjunto é embaralhada antes da construção: cada
+  // `push_back` recebe uma posição aleatória, como em um heap fragmentado pelo uso
+  PoolMemoria memoria;
+  size_t tamanhoNo = sequencial.memoryUsage() / sequencial.size();
+  std::vector<void*> posicoes(n);
+  for (void*& posicao : posicoes) posicao = memoria.alocar(tamanhoNo, alignof(long long));
+
+  bench::Aleatorio aleatorio;
+  for (size_t i = n; i > 1; --i) std::swap(posicoes[i - 1], posicoes[aleatorio.proximo() % i]);
+  for (void* posicao : posicoes) memoria.liberar(posicao, tamanhoNo, alignof(long long));
+
+  Lista<long long, PoolAllocator<long long>> espalhada{PoolAllocator<long long>(memoria)};
+  for (size_t i = 0; i < n; ++i) espalhada.push_back(static_cast<long long>(i));
+
+  ListaDesenrolada<long long> desenrolada;
+  for (size_t i = 0; i < n; ++i) desenrolada.push_back(static_cast<long long>(i));
+
+  // As operações por posição percorrem a lista, então usam listas menores
+  size_t pequeno = std::min<size_t>(n, 1 << 16);
+
+  // Construída com inserções em posições aleatórias, então os nós ficam entre meio cheios e cheios
+  ListaDesenrolada<long long> divididos;
+  for (size_t i = 0; i < pequeno; ++i) {
+    divididos.insert(static_cast<long long>(i), aleatorio.proximo() % (i + 1));
+  }
+
+  std::cout << "Percurso" << std::endl;
+  medirPercurso("Lista (nos em sequencia)", sequencial, voltas);
+  medirPercurso("Lista (nos espalhados)", espalhada, voltas);
+  medirPercurso("ListaDesenrolada (nos cheios)", desenrolada, voltas);
+  medirPercurso("ListaDesenrolada (insercoes aleatorias)", divididos, voltas);
+
+  Lista<long long> listaMeio;
+  for (size_t i = 0; i < pequeno; ++i) listaMeio.push_back(static_cast<long long>(i));
+
+  std::cout << "insert/remove no meio (" << pequeno << " elementos)" << std::endl;
+  medirMeio("Lista", listaMeio, operacoes);
+  medirMeio("ListaDesenrolada", divididos, operacoes);
+
+  return 0;
+}
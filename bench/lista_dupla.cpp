@@ -0,0 +1,81 @@
+#include <cstdlib>
+
+#include "bench.hpp"
+#include "data-structures/Lista.hpp"
+#include "data-structures/ListaDupla.hpp"
+
+/**
+ * @brief Enche a lista e a esvazia pelo final, como uma pilha
+ *
+ */
+template <typename ListaTipo>
+void medirEsvaziamento(const char* nome, size_t n) {
+  ListaTipo lista;
+  double tempo = bench::medir([&] {
+    for (size_t i = 0; i < n; ++i) lista.push_back(static_cast<long long>(i));
+    while (lista.size() > 0) lista.pop_back();
+  });
+  bench::reportar(nome, 2.0 * n / tempo, "ops/s");
+}
+
+/**
+ * @brief Mantém `n` elementos e alterna `push_back` com `pop_back`, desfazendo o último passo
+ *
+ */
+template <typename ListaTipo>
+void medirDesfazer(const char* nome, size_t n, size_t operacoes) {
+  ListaTipo lista;
+  for (size_t i = 0; i < n; ++i) lista.push_back(static_cast<long long>(i));
+
+  double tempo = bench::medir([&] {
+    for (size_t i = 0; i < operacoes; ++i) {
+      lista.push_back(static_cast<long long>(i));
+      lista.pop_back();
+    }
+  });
+  bench::reportar(nome, 2.0 * operacoes / tempo, "ops/s");
+}
+
+/**
+ * @brief Insere e remove perto do final, onde a `ListaDupla` anda a partir da sentinela
+ *
+ */
+template <typename ListaTipo>
+void medirPertoDoFim(const char* nome, size_t n, size_t operacoes) {
+  ListaTipo lista;
+  for (size_t i = 0; i < n; ++i) lista.push_back(static_cast<long long>(i));
+
+  double tempo = bench::medir([&] {
+    for (size_t i = 0; i < operacoes; ++i) {
+      lista.insert(static_cast<long long>(i), lista.size() - 8);
+      lista.remove(lista.size() - 8);
+    }
+  });
+  bench::reportar(nome, 2.0 * operacoes / tempo, "ops/s");
+}
+
+int main(int argc, char* argv[]) {
+  size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 20;
+  size_t operacoes = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1 << 20;
+
+  // `Lista::pop_back` percorre a lista inteira, então ela usa tamanhos e contagens menores
+  size_t pequeno = n / 64;
+  size_t poucas = operacoes / 1024;
+
+  std::cout << "push_back seguido de pop_back ate esvaziar" << std::endl;
+  std::cout << " " << pequeno << " elementos" << std::endl;
+  medirEsvaziamento<Lista<long long>>("Lista", pequeno);
+  medirEsvaziamento<ListaDupla<long long>>("ListaDupla", pequeno);
+  std::cout << " " << n << " elementos" << std::endl;
+  medirEsvaziamento<ListaDupla<long long>>("ListaDupla", n);
+
+  std::cout << "push_back/pop_back alternados (" << n << " elementos)" << std::endl;
+  medirDesfazer<Lista<long long>>("Lista", n, poucas);
+  medirDesfazer<ListaDupla<long long>>("ListaDupla", n, operacoes);
+
+  std::cout << "insert/remove perto do fim (" << n << " elementos)" << std::endl;
+  medirPertoDoFim<Lista<long long>>("Lista", n, poucas);
+  medirPertoDoFim<ListaDupla<long long>>("ListaDupla", n, operacoes);
+
+  return 0;
+}
@@ -0,0 +1,79 @@
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+#include "bench.hpp"
+#include "data-structures/Lista.hpp"
+#include "data-structures/ListaDesenrolada.hpp"
+#include "data-structures/ListaIndexada.hpp"
+
+/**
+ * @brief Insere e remove em posições aleatórias, mantendo o tamanho da lista
+ *
+ */
+template <typename ListaTipo>
+void medirEdicoes(const char* nome, ListaTipo& lista, size_t operacoes) {
+  bench::Aleatorio aleatorio(42);
+  double tempo = bench::medir([&] {
+    for (size_t i = 0; i < operacoes; ++i) {
+      lista.insert(static_cast<long long>(i), aleatorio.proximo() % (lista.size() + 1));
+      lista.remove(aleatorio.proximo() % lista.size());
+    }
+  });
+  bench::reportar(nome, 2.0 * operacoes / tempo, "ops/s");
+}
+
+/**
+ * @brief Percorre a lista do início ao fim e reporta a banda
+ *
+ */
+template <typename ListaTipo>
+void medirPercurso(const char* nome, const ListaTipo& lista) {
+  long long soma = 0;
+  double tempo = bench::medir([&] {
+    for (long long valor : lista) soma += valor;
+  });
+  bench::naoOtimizar(soma);
+
+  double bytes = static_cast<double>(lista.size() * sizeof(long long));
+  std::cout << "  " << nome << ": " << bytes / tempo / 1e9 << " GB/s, "
+            << static_cast<double>(lista.memoryUsage()) / lista.size() << " bytes/elemento"
+            << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+  size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 20;
+  size_t operacoes = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1000;
+
+  Lista<long long> lista;
+  ListaDesenrolada<long long> desenrolada;
+  ListaIndexada<long long> indexada;
+  for (size_t i = 0; i < n; ++i) {
+    lista.push_back(static_cast<long long>(i));
+    desenrolada.push_back(static_cast<long long>(i));
+    indexada.push_back(static_cast<long long>(i));
+  }
+
+  std::cout << n << " elementos, altura da ListaIndexada " << indexada.height() << std::endl;
+
+  // As listas lineares custam O(n) por operação, então fazem menos operações
+  std::cout << "insert/remove em posicoes aleatorias" << std::endl;
+  medirEdicoes("Lista", lista, operacoes);
+  medirEdicoes("ListaDesenrolada", desenrolada, operacoes);
+  medirEdicoes("ListaIndexada", indexada, 100 * operacoes);
+
+  long long soma = 0;
+  bench::Aleatorio aleatorio(7);
+  double tempo = bench::medir([&] {
+    for (size_t i = 0; i < 100 * operacoes; ++i) soma += indexada.at(aleatorio.proximo() % n);
+  });
+  bench::naoOtimizar(soma);
+  bench::reportar("ListaIndexada::at", 100.0 * operacoes / tempo, "ops/s");
+
+  std::cout << "Percurso" << std::endl;
+  medirPercurso("Lista", lista);
+  medirPercurso("ListaDesenrolada", desenrolada);
+  medirPercurso("ListaIndexada", indexada);
+
+  return 0;
+}
@@ -0,0 +1,107 @@
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "algorithms/WorkStealingPool.hpp"
+#include "allocators/PoolAllocator.hpp"
+#include "bench.hpp"
+#include "data-structures/Lista.hpp"
+
+/**
+ * @brief Cria uma lista com `n` valores aleatórios
+ *
+ */
+template <typename ListaTipo, typename Gerar>
+void encher(ListaTipo& lista, size_t n, uint64_t semente, Gerar gerar) {
+  bench::Aleatorio aleatorio(semente);
+  for (size_t i = 0; i < n; ++i) lista.push_back(gerar(aleatorio.proximo() % (4 * n)));
+}
+
+/**
+ * @brief Ordena como era feito antes: copia para um vetor, ordena e reconstrói a lista
+ *
+ */
+template <typename ListaTipo>
+void ordenarPorVetor(ListaTipo& lista) {
+  using Valor = typename ListaTipo::const_iterator::value_type;
+  std::vector<Valor> valores(lista.begin(), lista.end());
+  std::stable_sort(valores.begin(), valores.end());
+
+  lista.clear();
+  for (const Valor& valor : valores) lista.push_back(valor);
+}
+
+/**
+ * @brief Compara a ordenação pelo vetor com `Lista::sort` sequencial e paralelo
+ *
+ * Cada caso usa um conjunto de memória novo, para que os nós de todas as listas comecem em
+ * sequência na memória (e não espalhados pelo que os casos anteriores liberaram).
+ */
+template <typename Valor, typename Gerar>
+void comparar(size_t n, WorkStealingPool& pool, Gerar gerar) {
+  using ListaBench = Lista<Valor, PoolAllocator<Valor>>;
+  {
+    PoolMemoria memoria;
+    ListaBench lista{PoolAllocator<Valor>(memoria)};
+    encher(lista, n, 1, gerar);
+    double tempo = bench::medir([&] { ordenarPorVetor(lista); });
+    bench::reportar("vetor + std::stable_sort + reconstrucao", n / tempo, "elementos/s");
+  }
+  {
+    PoolMemoria memoria;
+    ListaBench lista{PoolAllocator<Valor>(memoria)};
+    encher(lista, n, 1, gerar);
+    double tempo = bench::medir([&] { lista.sort(); });
+    bench::reportar("Lista::sort", n / tempo, "elementos/s");
+  }
+  {
+    PoolMemoria memoria;
+    ListaBench lista{PoolAllocator<Valor>(memoria)};
+    encher(lista, n, 1, gerar);
+    double tempo = bench::medir([&] { lista.sort(pool); });
+    bench::reportar("Lista::sort (paralelo)", n / tempo, "elementos/s");
+  }
+}
+
+int main(int argc, char* argv[]) {
+  size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 21;
+  size_t threads = argc > 2 ? std::strtoull(argv[2], nullptr, 10)
+                            : std::max(1u, std::thread::hardware_concurrency());
+
+  std::cout << n << " elementos, " << threads << " threads" << std::endl;
+
+  WorkStealingPool pool(threads);
+
+  std::cout << "sort (long long)" << std::endl;
+  comparar<long long>(n, pool, [](uint64_t x) { return static_cast<long long>(x); });
+
+  // Strings maiores que o buffer interno: a ida e volta pelo vetor copia e aloca cada uma
+  std::cout << "sort (std::string de 32 caracteres, " << n / 4 << " elementos)" << std::endl;
+  comparar<std::string>(n / 4, pool, [](uint64_t x) {
+    std::string texto = std::to_string(x);
+    return std::string(32 - texto.size(), '0') + texto;
+  });
+
+  std::cout << "merge e unique" << std::endl;
+  {
+    PoolMemoria memoria;
+    Lista<long long, PoolAllocator<long long>> lista{PoolAllocator<long long>(memoria)};
+    Lista<long long, PoolAllocator<long long>> outra{PoolAllocator<long long>(memoria)};
+    auto gerar = [](uint64_t x) { return static_cast<long long>(x); };
+    encher(lista, n / 2, 2, gerar);
+    encher(outra, n / 2, 3, gerar);
+    lista.sort();
+    outra.sort();
+
+    double tempo = bench::medir([&] { lista.merge(outra); });
+    bench::reportar("Lista::merge", n / tempo, "elementos/s");
+
+    tempo = bench::medir([&] { lista.unique(); });
+    bench::reportar("Lista::unique", n / tempo, "elementos/s");
+    std::cout << "  (" << lista.size() << " elementos distintos)" << std::endl;
+  }
+
+  return 0;
+}
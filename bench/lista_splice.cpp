@@ -0,0 +1,72 @@
+#include <cstdlib>
+#include <vector>
+
+#include "bench.hpp"
+#include "data-structures/Lista.hpp"
+#include "data-structures/ListaDupla.hpp"
+
+/**
+ * @brief Divide uma lista de `n` elementos em `partes` pedaços e os junta de novo, religando os nós
+ * com `split_at` e `append`
+ *
+ */
+template <typename ListaTipo>
+void medirReligando(const char* nome, size_t n, size_t partes) {
+  ListaTipo lista;
+  for (size_t i = 0; i < n; ++i) lista.push_back(static_cast<long long>(i));
+
+  size_t passo = n / partes;
+  double tempo = bench::medir([&] {
+    // Cada divisão separa o começo do último pedaço, então só anda `passo` elementos
+    std::vector<ListaTipo> pedacos;
+    pedacos.reserve(partes);
+    pedacos.push_back(std::move(lista));
+    for (size_t i = 1; i < partes; ++i) pedacos.push_back(pedacos.back().split_at(passo));
+
+    for (ListaTipo& pedaco : pedacos) lista.append(std::move(pedaco));
+  });
+  bench::naoOtimizar(lista.size());
+  bench::reportar(nome, n / tempo, "elementos/s");
+}
+
+/**
+ * @brief Faz a mesma divisão e junção copiando os elementos com `pop_front` e `push_back`
+ *
+ */
+template <typename ListaTipo>
+void medirCopiando(const char* nome, size_t n, size_t partes) {
+  ListaTipo lista;
+  for (size_t i = 0; i < n; ++i) lista.push_back(static_cast<long long>(i));
+
+  size_t passo = n / partes;
+  double tempo = bench::medir([&] {
+    std::vector<ListaTipo> pedacos(partes);
+    for (size_t i = 0; i < partes; ++i) {
+      for (size_t j = 0; j < passo && lista.size() > 0; ++j) {
+        pedacos[i].push_back(lista.front());
+        lista.pop_front();
+      }
+    }
+
+    for (ListaTipo& pedaco : pedacos) {
+      while (pedaco.size() > 0) {
+        lista.push_back(pedaco.front());
+        pedaco.pop_front();
+      }
+    }
+  });
+  bench::naoOtimizar(lista.size());
+  bench::reportar(nome, n / tempo, "elementos/s");
+}
+
+int main(int argc, char* argv[]) {
+  size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 22;
+  size_t partes = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 64;
+
+  std::cout << "dividir em " << partes << " pedacos e juntar (" << n << " elementos)" << std::endl;
+  medirCopiando<ListaDupla<long long>>("ListaDupla pop_front/push_back", n, partes);
+  medirReligando<Lista<long long>>("Lista split_at/append", n, partes);
+  medirReligando<ListaDupla<long long>>("ListaDupla split_at/append", n, partes);
+
+  return 0;
+}
@@ -0,0 +1,189 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <list>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "bench.hpp"
+#include "data-structures/LruCache.hpp"
+
+/**
+ * @brief Gera `quantidade` chaves em [0, universo) com distribuição de Zipf de expoente `s`
+ *
+ * A chave k aparece com probabilidade proporcional a 1 / (k + 1)^s; as chaves são sorteadas por
+ * busca binária na distribuição acumulada.
+ */
+std::vector<long long> gerarZipf(size_t universo, double s, size_t quantidade) {
+  std::vector<double> acumulada(universo);
+  double soma = 0;
+  for (size_t k = 0; k < universo; ++k) {
+    soma += 1.0 / std::pow(static_cast<double>(k + 1), s);
+    acumulada[k] = soma;
+  }
+
+  // Embaralha os nomes das chaves para as quentes não ficarem vizinhas no hash
+  std::vector<long long> nomes(universo);
+  bench::Aleatorio aleatorio;
+  for (size_t k = 0; k < universo; ++k) nomes[k] = static_cast<long long>(k);
+  for (size_t k = universo; k > 1; --k) std::swap(nomes[k - 1], nomes[aleatorio.proximo() % k]);
+
+  std::vector<long long> chaves(quantidade);
+  for (long long& chave : chaves) {
+    double u = static_cast<double>(aleatorio.proximo() >> 11) / 9007199254740992.0 * soma;
+    size_t k = std::lower_bound(acumulada.begin(), acumulada.end(), u) - acumulada.begin();
+    chave = nomes[std::min(k, universo - 1)];
+  }
+  return chaves;
+}
+
+/**
+ * @brief LRU escrito à mão com `std::list` e `std::unordered_map`, como os que o cache substitui
+ *
+ */
+class LruManual {
+ private:
+  std::list<std::pair<long long, long long>> ordem;
+  std::unordered_map<long long, std::list<std::pair<long long, long long>>::iterator> mapa;
+  size_t capacidade;
+  size_t acertos;
+  size_t faltas;
+
+ public:
+  explicit LruManual(size_t capacidade) : capacidade(capacidade), acertos(0), faltas(0) {}
+
+  long long* get(long long chave) {
+    auto encontrado = mapa.find(chave);
+    if (encontrado == mapa.end()) {
+      ++faltas;
+      return nullptr;
+    }
+    ++acertos;
+    ordem.splice(ordem.begin(), ordem, encontrado->second);
+    return &encontrado->second->second;
+  }
+
+  size_t hits() const { return acertos; }
+  size_t misses() const { return faltas; }
+
+  void put(long long chave, long long valor) {
+    ordem.emplace_front(chave, valor);
+    mapa[chave] = ordem.begin();
+    if (ordem.size() > capacidade) {
+      mapa.erase(ordem.back().first);
+      ordem.pop_back();
+    }
+  }
+};
+
+/**
+ * @brief Reporta a vazão e a taxa de acertos contada pelo próprio cache
+ *
+ */
+template <typename Cache>
+void reportar(const char* nome, const Cache& cache, size_t operacoes, double tempo) {
+  std::cout << "  " << nome << ": " << operacoes / tempo << " ops/s, "
+            << 100.0 * cache.hits() / (cache.hits() + cache.misses()) << "% de acertos"
+            << std::endl;
+}
+
+/**
+ * @brief Para cada chave, faz `get` e, na falta, `put` (o padrão de um cache na frente de uma
+ * busca lenta)
+ *
+ */
+template <typename Cache>
+void medir(const char* nome, Cache& cache, const std::vector<long long>& chaves) {
+  double tempo = bench::medir([&] {
+    for (long long chave : chaves) {
+      if (cache.get(chave) == nullptr) cache.put(chave, chave);
+    }
+  });
+
+  reportar(nome, cache, chaves.size(), tempo);
+}
+
+/**
+ * @brief Tamanho declarado do valor de uma chave: entre 64 e 1024 bytes, fixo para cada chave
+ *
+ */
+size_t bytesDaChave(long long chave) {
+  return 64 * (1 + static_cast<size_t>(chave) % 16);
+}
+
+/**
+ * @brief Como `medir`, mas cada `put` declara o tamanho do valor, para caches com orçamento de
+ * bytes; também reporta os bytes ocupados no final
+ *
+ */
+void medirComOrcamento(const char* nome, LruCache<long long, long long>& cache,
+                       const std::vector<long long>& chaves) {
+  double tempo = bench::medir([&] {
+    for (long long chave : chaves) {
+      if (cache.get(chave) == nullptr) cache.put(chave, chave, bytesDaChave(chave));
+    }
+  });
+
+  reportar(nome, cache, chaves.size(), tempo);
+  std::cout << "    " << cache.size() << " entradas, " << cache.bytes() << " bytes, "
+            << cache.evictions() << " despejos" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+  size_t universo = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 20;
+  size_t operacoes = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1 << 22;
+  double s = argc > 3 ? std::strtod(argv[3], nullptr) : 0.99;
+
+  std::vector<long long> chaves = gerarZipf(universo, s, operacoes);
+  std::cout << universo << " chaves, Zipf s = " << s << ", " << operacoes << " operacoes"
+            << std::endl;
+
+  // Com universos pequenos a capacidade ainda precisa ser positiva
+  size_t pequena = std::max<size_t>(1, universo / 100);
+  size_t grande = std::max<size_t>(1, universo / 10);
+
+  for (size_t capacidade : {pequena, grande}) {
+    std::cout << "capacidade " << capacidade << std::endl;
+
+    LruManual manual(capacidade);
+    medir("std::list + std::unordered_map", manual, chaves);
+
+    LruCache<long long, long long> lru(capacidade);
+    medir("LruCache (LRU)", lru, chaves);
+
+    LruCache<long long, long long> slru(capacidade, 0, PoliticaCache::SLRU);
+    medir("LruCache (SLRU)", slru, chaves);
+  }
+
+  // Uma varredura de chaves novas no meio da carga: o SLRU protege as chaves quentes
+  std::vector<long long> comVarredura(chaves.begin(), chaves.begin() + chaves.size() / 2);
+  for (size_t i = 0; i < universo / 10; ++i) {
+    comVarredura.push_back(static_cast<long long>(universo + i));
+  }
+  comVarredura.insert(comVarredura.end(), chaves.begin() + chaves.size() / 2, chaves.end());
+
+  size_t capacidade = pequena;
+  std::cout << "capacidade " << capacidade << ", com varredura de " << universo / 10
+            << " chaves novas" << std::endl;
+
+  LruCache<long long, long long> lru(capacidade);
+  medir("LruCache (LRU)", lru, comVarredura);
+
+  LruCache<long long, long long> slru(capacidade, 0, PoliticaCache::SLRU);
+  medir("LruCache (SLRU)", slru, comVarredura);
+
+  // Valores de tamanhos diferentes: o orçamento (em média `capacidade` valores) limita o cache
+  // antes da quantidade de entradas
+  size_t orcamento = capacidade * bytesDaChave(7);
+  std::cout << "capacidade " << 4 * capacidade << ", orcamento de " << orcamento << " bytes"
+            << std::endl;
+
+  LruCache<long long, long long> lruBytes(4 * capacidade, orcamento);
+  medirComOrcamento("LruCache (LRU)", lruBytes, chaves);
+
+  LruCache<long long, long long> slruBytes(4 * capacidade, orcamento, PoliticaCache::SLRU);
+  medirComOrcamento("LruCache (SLRU)", slruBytes, chaves);
+
+  return 0;
+}
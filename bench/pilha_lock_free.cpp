@@ -0,0 +1,90 @@
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+
+#include "bench.hpp"
+#include "data-structures/Pilha.hpp"
+#include "data-structures/PilhaLockFree.hpp"
+
+/**
+ * @brief `Pilha` protegida por um mutex, usada como referência
+ *
+ */
+class PilhaComMutex {
+ private:
+  Pilha<long long> pilha;
+  std::mutex trava;
+
+ public:
+  void push(long long dado) {
+    std::lock_guard<std::mutex> guarda(trava);
+    pilha.push(dado);
+  }
+
+  bool try_pop(long long& saida) {
+    std::lock_guard<std::mutex> guarda(trava);
+    if (pilha.isEmpty()) return false;
+    saida = pilha.top();
+    pilha.pop();
+    return true;
+  }
+};
+
+/**
+ * @brief Teste de estresse + medição: cada thread alterna rajadas de `push` e `pop` de valores
+ * únicos. No final a pilha é esvaziada e a soma de tudo que saiu é comparada com a soma de tudo
+ * que entrou, o que detecta elementos perdidos ou duplicados.
+ *
+ * @return double Milhões de operações por segundo
+ */
+template <typename PilhaTipo>
+double estresse(size_t threads, size_t porThread, bool& correto) {
+  PilhaTipo pilha;
+  std::atomic<long long> somaRemovidos(0);
+
+  double segundos = bench::medir([&] {
+    std::vector<std::thread> grupo;
+    for (size_t t = 0; t < threads; ++t) {
+      grupo.emplace_back([&, t] {
+        long long parcial = 0;
+        long long valor;
+        for (size_t i = 0; i < porThread; ++i) {
+          pilha.push(static_cast<long long>(t * porThread + i + 1));
+          if (i % 4 != 0 && pilha.try_pop(valor)) parcial += valor;
+        }
+        somaRemovidos.fetch_add(parcial);
+      });
+    }
+    for (std::thread& thread : grupo) thread.join();
+  });
+
+  long long valor;
+  long long soma = somaRemovidos.load();
+  while (pilha.try_pop(valor)) soma += valor;
+
+  long long total = static_cast<long long>(threads * porThread);
+  correto = soma == total * (total + 1) / 2;
+
+  // Cada iteração faz um push e (na maioria das vezes) um pop
+  return 2.0 * threads * porThread / segundos / 1e6;
+}
+
+int main(int argc, char* argv[]) {
+  size_t porThread = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+  size_t maximo = argc > 2 ? std::strtoull(argv[2], nullptr, 10)
+                           : std::max(8u, std::thread::hardware_concurrency());
+
+  for (size_t threads = 1; threads <= maximo; threads *= 2) {
+    std::cout << threads << " thread(s)" << std::endl;
+
+    bool correto;
+    double vazao = estresse<PilhaComMutex>(threads, porThread, correto);
+    bench::reportar(std::string("Pilha + mutex") + (correto ? "" : " [FALHA]"), vazao, "Mops/s");
+
+    vazao = estresse<PilhaLockFree<long long>>(threads, porThread, correto);
+    bench::reportar(std::string("PilhaLockFree") + (correto ? "" : " [FALHA]"), vazao, "Mops/s");
+  }
+
+  return 0;
+}
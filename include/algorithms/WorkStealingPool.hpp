@@ -0,0 +1,297 @@
+#ifndef WORK_STEALING_POOL_HPP
+#define WORK_STEALING_POOL_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Conjunto de threads para paralelismo do tipo fork-join, com roubo de tarefas
+ *
+ * Cada thread do conjunto tem a sua própria fila de tarefas. Novas tarefas entram no fim da fila da
+ * thread que as criou, e a thread retira do fim (a tarefa mais recente, cujos dados ainda estão na
+ * cache). Uma thread sem tarefas rouba do início da fila de outra (a tarefa mais antiga, que
+ * costuma ser a maior). Tarefas criadas por threads de fora do conjunto entram em uma fila comum.
+ *
+ * As tarefas são criadas e aguardadas com um `Grupo`. Enquanto aguarda, a thread executa outras
+ * tarefas em vez de dormir, então grupos podem ser aninhados sem travar o conjunto.
+ */
+class WorkStealingPool {
+ private:
+  struct Tarefa;
+
+ public:
+  /**
+   * @brief Grupo de tarefas que são aguardadas juntas
+   *
+   */
+  class Grupo {
+   public:
+    explicit Grupo(WorkStealingPool& pool) : pool(pool), pendentes(0) {}
+    Grupo(const Grupo&) = delete;
+    Grupo& operator=(const Grupo&) = delete;
+
+    /**
+     * @brief Aguarda as tarefas que ainda estiverem pendentes (ignorando exceções)
+     *
+     */
+    ~Grupo();
+
+    /**
+     * @brief Cria uma tarefa que executa `funcao` em alguma thread do conjunto
+     *
+     */
+    template <typename Funcao>
+    void executar(Funcao&& funcao);
+
+    /**
+     * @brief Aguarda todas as tarefas do grupo, executando tarefas pendentes enquanto isso
+     *
+     * @throw A primeira exceção lançada por uma tarefa do grupo, se houver
+     */
+    void aguardar();
+
+   private:
+    WorkStealingPool& pool;
+    std::atomic<size_t> pendentes;
+
+    std::mutex travaErro;
+    std::exception_ptr erro;
+
+    friend class WorkStealingPool;
+  };
+
+  /**
+   * @brief Cria o conjunto com a quantidade de threads indicada
+   *
+   * @param quantidadeThreads Padrão: número de núcleos da máquina
+   */
+  explicit WorkStealingPool(size_t quantidadeThreads = std::thread::hardware_concurrency());
+  WorkStealingPool(const WorkStealingPool&) = delete;
+  WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+  ~WorkStealingPool();
+
+  /**
+   * @brief Retorna a quantidade de threads do conjunto
+   *
+   * @return size_t
+   */
+  size_t size() const;
+
+ private:
+  struct Tarefa {
+    std::function<void()> funcao;
+    Grupo* grupo;
+  };
+
+  struct alignas(64) FilaTarefas {
+    std::mutex trava;
+    std::deque<Tarefa*> tarefas;
+  };
+
+  /**
+   * @brief Tempo máximo que uma thread sem tarefas dorme antes de procurar de novo
+   *
+   */
+  static constexpr std::chrono::milliseconds ESPERA_MAXIMA{1};
+
+  /**
+   * @brief Uma fila por thread do conjunto e, na última posição, a fila comum
+   *
+   */
+  std::vector<std::unique_ptr<FilaTarefas>> filas;
+  std::vector<std::thread> threads;
+
+  std::atomic<size_t> pendentes;
+  std::atomic<bool> encerrando;
+
+  std::mutex travaSono;
+  std::condition_variable temTarefa;
+  std::atomic<size_t> dormindo;
+
+  /**
+   * @brief Índice da fila da thread atual neste conjunto (a fila comum para threads de fora)
+   *
+   */
+  size_t filaAtual() const;
+
+  static WorkStealingPool*& poolDaThread();
+  static size_t& indiceDaThread();
+
+  void adicionar(Tarefa* tarefa);
+
+  /**
+   * @brief Retira uma tarefa: primeiro do fim da própria fila, depois do início das outras
+   *
+   * @return Tarefa* `nullptr` se não houver nenhuma tarefa
+   */
+  Tarefa* retirar(size_t indice);
+
+  static void executar(Tarefa* tarefa);
+
+  void trabalhar(size_t indice);
+};
+
+inline WorkStealingPool::WorkStealingPool(size_t quantidadeThreads)
+    : pendentes(0), encerrando(false), dormindo(0) {
+  if (quantidadeThreads == 0) quantidadeThreads = 1;
+
+  for (size_t i = 0; i <= quantidadeThreads; ++i) {
+    filas.emplace_back(new FilaTarefas());
+  }
+
+  for (size_t i = 0; i < quantidadeThreads; ++i) {
+    threads.emplace_back([this, i] { trabalhar(i); });
+  }
+}
+
+inline WorkStealingPool::~WorkStealingPool() {
+  {
+    std::lock_guard<std::mutex> guarda(travaSono);
+    encerrando.store(true, std::memory_order_release);
+  }
+  temTarefa.notify_all();
+
+  for (std::thread& thread : threads) thread.join();
+}
+
+inline size_t WorkStealingPool::size() const {
+  return threads.size();
+}
+
+inline WorkStealingPool*& WorkStealingPool::poolDaThread() {
+  static thread_local WorkStealingPool* pool = nullptr;
+  return pool;
+}
+
+inline size_t& WorkStealingPool::indiceDaThread() {
+  static thread_local size_t indice = 0;
+  return indice;
+}
+
+inline size_t WorkStealingPool::filaAtual() const {
+  return poolDaThread() == this ? indiceDaThread() : threads.size();
+}
+
+inline void WorkStealingPool::adicionar(WorkStealingPool::Tarefa* tarefa) {
+  // O contador é incrementado antes de a tarefa ficar visível para que nunca fique negativo
+  pendentes.fetch_add(1, std::memory_order_release);
+
+  FilaTarefas& fila = *filas[filaAtual()];
+  {
+    std::lock_guard<std::mutex> guarda(fila.trava);
+    fila.tarefas.push_back(tarefa);
+  }
+
+  if (dormindo.load(std::memory_order_acquire) > 0) {
+    temTarefa.notify_one();
+  }
+}
+
+inline WorkStealingPool::Tarefa* WorkStealingPool::retirar(size_t indice) {
+  if (pendentes.load(std::memory_order_acquire) == 0) return nullptr;
+
+  {
+    FilaTarefas& propria = *filas[indice];
+    std::lock_guard<std::mutex> guarda(propria.trava);
+    if (!propria.tarefas.empty()) {
+      Tarefa* tarefa = propria.tarefas.back();
+      propria.tarefas.pop_back();
+      pendentes.fetch_sub(1, std::memory_order_relaxed);
+      return tarefa;
+    }
+  }
+
+  // Rouba das outras filas, começando pela vizinha para espalhar os roubos
+  for (size_t i = 1; i < filas.size(); ++i) {
+    FilaTarefas& vitima = *filas[(indice + i) % filas.size()];
+    std::lock_guard<std::mutex> guarda(vitima.trava);
+    if (!vitima.tarefas.empty()) {
+      Tarefa* tarefa = vitima.tarefas.front();
+      vitima.tarefas.pop_front();
+      pendentes.fetch_sub(1, std::memory_order_relaxed);
+      return tarefa;
+    }
+  }
+
+  return nullptr;
+}
+
+inline void WorkStealingPool::executar(WorkStealingPool::Tarefa* tarefa) {
+  Grupo* grupo = tarefa->grupo;
+
+  try {
+    tarefa->funcao();
+  } catch (...) {
+    std::lock_guard<std::mutex> guarda(grupo->travaErro);
+    if (!grupo->erro) grupo->erro = std::current_exception();
+  }
+
+  delete tarefa;
+  grupo->pendentes.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+inline void WorkStealingPool::trabalhar(size_t indice) {
+  poolDaThread() = this;
+  indiceDaThread() = indice;
+
+  while (!encerrando.load(std::memory_order_acquire)) {
+    Tarefa* tarefa = retirar(indice);
+    if (tarefa != nullptr) {
+      executar(tarefa);
+      continue;
+    }
+
+    // Sem tarefas: dorme até ser avisado (ou por pouco tempo, para não depender só do aviso)
+    std::unique_lock<std::mutex> guarda(travaSono);
+    dormindo.fetch_add(1, std::memory_order_acq_rel);
+    temTarefa.wait_for(guarda, ESPERA_MAXIMA, [this] {
+      return pendentes.load(std::memory_order_acquire) > 0 ||
+             encerrando.load(std::memory_order_acquire);
+    });
+    dormindo.fetch_sub(1, std::memory_order_acq_rel);
+  }
+}
+
+template <typename Funcao>
+void WorkStealingPool::Grupo::executar(Funcao&& funcao) {
+  pendentes.fetch_add(1, std::memory_order_relaxed);
+  pool.adicionar(new Tarefa{std::function<void()>(std::forward<Funcao>(funcao)), this});
+}
+
+inline void WorkStealingPool::Grupo::aguardar() {
+  size_t indice = pool.filaAtual();
+
+  while (pendentes.load(std::memory_order_acquire) > 0) {
+    // Ajuda a esvaziar as filas (possivelmente executando as próprias tarefas do grupo)
+    Tarefa* tarefa = pool.retirar(indice);
+    if (tarefa != nullptr) {
+      WorkStealingPool::executar(tarefa);
+    } else {
+      std::this_thread::yield();
+    }
+  }
+
+  if (erro) {
+    std::exception_ptr lancar = erro;
+    erro = nullptr;
+    std::rethrow_exception(lancar);
+  }
+}
+
+inline WorkStealingPool::Grupo::~Grupo() {
+  try {
+    aguardar();
+  } catch (...) {
+  }
+}
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef ALOCADOR_MONOTONICO_HPP
+#define ALOCADOR_MONOTONICO_HPP
+
+#include <type_traits>
+
+/**
+ * @brief Indica se um alocador é monotônico, ou seja, se o seu `deallocate` não faz nada
+ *
+ * Um alocador se declara monotônico com `using is_monotonic = std::true_type;`. Os containers usam
+ * essa informação para não percorrer os nós na destruição quando os valores também não precisam
+ * ser destruídos: a memória só é devolvida quando a arena inteira for liberada.
+ *
+ * @tparam Allocator
+ */
+template <typename Allocator, typename = void>
+struct AlocadorMonotonico : std::false_type {};
+
+template <typename Allocator>
+struct AlocadorMonotonico<Allocator, std::void_t<typename Allocator::is_monotonic>>
+    : Allocator::is_monotonic {};
+
+/**
+ * @brief Indica se os nós de um container podem ser abandonados sem serem percorridos
+ *
+ * É o caso quando o alocador é monotônico e o valor tem destrutor trivial.
+ */
+template <typename Allocator, typename Type>
+struct DescarteSemPercurso
+    : std::integral_constant<bool, AlocadorMonotonico<Allocator>::value &&
+                                       std::is_trivially_destructible<Type>::value> {};
+
+#endif
@@ -0,0 +1,163 @@
+#ifndef ARENA_ALLOCATOR_HPP
+#define ARENA_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+/**
+ * @brief Arena de memória monotônica
+ *
+ * Cada alocação apenas avança um ponteiro dentro do bloco atual, e nada é devolvido
+ * individualmente: toda a memória é liberada de uma vez por `reset` ou pela destruição da arena.
+ * Quando o bloco atual acaba, um novo bloco com o dobro do tamanho é pedido ao sistema.
+ *
+ * A arena não é thread-safe.
+ */
+class ArenaMemoria {
+ public:
+  /**
+   * @brief Cria a arena vazia
+   *
+   * @param tamanhoInicial Tamanho (em bytes) do primeiro bloco
+   */
+  explicit ArenaMemoria(size_t tamanhoInicial = 4096);
+  ArenaMemoria(const ArenaMemoria&) = delete;
+  ArenaMemoria& operator=(const ArenaMemoria&) = delete;
+  ~ArenaMemoria();
+
+  /**
+   * @brief Aloca `bytes` bytes alinhados a `alinhamento` (uma potência de 2)
+   *
+   * @throw `std::bad_alloc` se o sistema não tiver memória
+   */
+  void* alocar(size_t bytes, size_t alinhamento);
+
+  /**
+   * @brief Libera todos os blocos da arena de uma vez
+   *
+   * Tudo o que foi alocado nela deixa de ser válido.
+   */
+  void reset();
+
+  /**
+   * @brief Retorna quantos bytes de blocos a arena pediu ao sistema
+   *
+   * @return size_t
+   */
+  size_t reservado() const;
+
+ private:
+  struct alignas(std::max_align_t) Bloco {
+    Bloco* anterior;
+  };
+
+  Bloco* blocos;
+  char* atual;
+  char* limite;
+
+  size_t tamanhoInicial;
+  size_t proximoTamanho;
+  size_t reservados;
+};
+
+/**
+ * @brief Alocador (compatível com `std::allocator_traits`) que usa uma `ArenaMemoria`
+ *
+ * O `deallocate` não faz nada, e o alocador se declara monotônico: os containers com valores de
+ * destrutor trivial são destruídos em O(1), sem percorrer os nós. A arena precisa viver mais que
+ * os containers que a usam.
+ *
+ * @tparam Type
+ */
+template <typename Type>
+class ArenaAllocator {
+ public:
+  using value_type = Type;
+  using is_monotonic = std::true_type;
+
+  explicit ArenaAllocator(ArenaMemoria& arena) noexcept : arena(&arena) {}
+
+  template <typename Outro>
+  ArenaAllocator(const ArenaAllocator<Outro>& outro) noexcept : arena(outro.arena) {}
+
+  Type* allocate(size_t quantidade) {
+    if (quantidade > std::numeric_limits<size_t>::max() / sizeof(Type)) throw std::bad_alloc();
+    return static_cast<Type*>(arena->alocar(quantidade * sizeof(Type), alignof(Type)));
+  }
+
+  void deallocate(Type*, size_t) noexcept {}
+
+  template <typename Outro>
+  bool operator==(const ArenaAllocator<Outro>& outro) const noexcept {
+    return arena == outro.arena;
+  }
+
+  template <typename Outro>
+  bool operator!=(const ArenaAllocator<Outro>& outro) const noexcept {
+    return arena != outro.arena;
+  }
+
+ private:
+  ArenaMemoria* arena;
+
+  template <typename Outro>
+  friend class ArenaAllocator;
+};
+
+inline ArenaMemoria::ArenaMemoria(size_t tamanhoInicial)
+    : blocos(nullptr),
+      atual(nullptr),
+      limite(nullptr),
+      tamanhoInicial(tamanhoInicial < sizeof(Bloco) ? sizeof(Bloco) : tamanhoInicial),
+      proximoTamanho(this->tamanhoInicial),
+      reservados(0) {}
+
+inline ArenaMemoria::~ArenaMemoria() {
+  reset();
+}
+
+inline void* ArenaMemoria::alocar(size_t bytes, size_t alinhamento) {
+  uintptr_t inicio = (reinterpret_cast<uintptr_t>(atual) + alinhamento - 1) & ~(alinhamento - 1);
+
+  if (atual == nullptr || inicio + bytes > reinterpret_cast<uintptr_t>(limite)) {
+    // Espaço para o cabeçalho, o pedido e o pior caso do alinhamento
+    size_t necessario = sizeof(Bloco) + bytes + alinhamento;
+    while (proximoTamanho < necessario) proximoTamanho *= 2;
+
+    Bloco* bloco = static_cast<Bloco*>(::operator new(proximoTamanho));
+    bloco->anterior = blocos;
+    blocos = bloco;
+    reservados += proximoTamanho;
+
+    atual = reinterpret_cast<char*>(bloco + 1);
+    limite = reinterpret_cast<char*>(bloco) + proximoTamanho;
+    proximoTamanho *= 2;
+
+    inicio = (reinterpret_cast<uintptr_t>(atual) + alinhamento - 1) & ~(alinhamento - 1);
+  }
+
+  atual = reinterpret_cast<char*>(inicio + bytes);
+  return reinterpret_cast<void*>(inicio);
+}
+
+inline void ArenaMemoria::reset() {
+  while (blocos != nullptr) {
+    Bloco* anterior = blocos->anterior;
+    ::operator delete(blocos);
+    blocos = anterior;
+  }
+
+  atual = nullptr;
+  limite = nullptr;
+  proximoTamanho = tamanhoInicial;
+  reservados = 0;
+}
+
+inline size_t ArenaMemoria::reservado() const {
+  return reservados;
+}
+
+#endif
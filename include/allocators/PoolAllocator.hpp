@@ -0,0 +1,212 @@
+#ifndef POOL_ALLOCATOR_HPP
+#define POOL_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <limits>
+#include <new>
+
+/**
+ * @brief Conjunto de memória com listas livres por classe de tamanho
+ *
+ * Pedidos de até `TAMANHO_MAXIMO` bytes são arredondados para um múltiplo de `ALINHAMENTO` (a
+ * classe do pedido). Cada classe tem uma lista de posições livres, guardada dentro das próprias
+ * posições, então alocar e liberar são apenas um `pop` e um `push` nessa lista. Quando a lista está
+ * vazia, a posição é recortada do bloco atual, e os blocos são pedidos ao sistema de
+ * `TAMANHO_BLOCO` em `TAMANHO_BLOCO` bytes. Pedidos maiores (ou com alinhamento maior) vão direto
+ * para o `operator new`.
+ *
+ * A memória liberada volta para a lista da sua classe e não é devolvida ao sistema antes da
+ * destruição do conjunto. O conjunto não é thread-safe.
+ */
+class PoolMemoria {
+ public:
+  static constexpr size_t ALINHAMENTO = alignof(std::max_align_t);
+  static constexpr size_t QUANTIDADE_CLASSES = 16;
+  static constexpr size_t TAMANHO_MAXIMO = ALINHAMENTO * QUANTIDADE_CLASSES;
+  static constexpr size_t TAMANHO_BLOCO = 64 * 1024;
+
+  PoolMemoria();
+  PoolMemoria(const PoolMemoria&) = delete;
+  PoolMemoria& operator=(const PoolMemoria&) = delete;
+
+  /**
+   * @brief Devolve todos os blocos ao sistema (a memória ainda em uso também deixa de ser válida)
+   *
+   */
+  ~PoolMemoria();
+
+  /**
+   * @brief Aloca `bytes` bytes alinhados a `alinhamento`
+   *
+   * @throw `std::bad_alloc` se o sistema não tiver memória
+   */
+  void* alocar(size_t bytes, size_t alinhamento);
+
+  /**
+   * @brief Devolve uma região obtida com `alocar` (com os mesmos `bytes` e `alinhamento`)
+   *
+   */
+  void liberar(void* ponteiro, size_t bytes, size_t alinhamento);
+
+  /**
+   * @brief Retorna quantos bytes de blocos o conjunto pediu ao sistema
+   *
+   * @return size_t
+   */
+  size_t reservado() const;
+
+  /**
+   * @brief Conjunto usado pelos `PoolAllocator` criados sem um conjunto explícito
+   *
+   * Cada thread tem o seu. Ele nunca é destruído, para que nós criados por uma thread continuem
+   * válidos depois que ela termina.
+   */
+  static PoolMemoria& daThread();
+
+ private:
+  struct Livre {
+    Livre* proximo;
+  };
+
+  /**
+   * @brief Cabeçalho de um bloco, que ocupa as primeiras posições dele
+   *
+   */
+  struct alignas(ALINHAMENTO) Bloco {
+    Bloco* anterior;
+  };
+
+  Livre* livres[QUANTIDADE_CLASSES];
+  Bloco* blocos;
+
+  /**
+   * @brief Parte ainda não recortada do bloco mais recente
+   *
+   */
+  char* atual;
+  char* limite;
+
+  size_t reservados;
+
+  static size_t classe(size_t bytes);
+};
+
+/**
+ * @brief Alocador (compatível com `std::allocator_traits`) que usa um `PoolMemoria`
+ *
+ * Cópias do alocador, inclusive as de outros tipos (como as que os containers fazem para alocar
+ * os seus nós), compartilham o mesmo conjunto. Por padrão é usado o conjunto da thread atual, e
+ * nesse caso o container deve ser usado só pela thread que o criou.
+ *
+ * @tparam Type
+ */
+template <typename Type>
+class PoolAllocator {
+ public:
+  using value_type = Type;
+
+  PoolAllocator() noexcept : memoria(&PoolMemoria::daThread()) {}
+  explicit PoolAllocator(PoolMemoria& memoria) noexcept : memoria(&memoria) {}
+
+  template <typename Outro>
+  PoolAllocator(const PoolAllocator<Outro>& outro) noexcept : memoria(outro.memoria) {}
+
+  Type* allocate(size_t quantidade) {
+    if (quantidade > std::numeric_limits<size_t>::max() / sizeof(Type)) throw std::bad_alloc();
+    return static_cast<Type*>(memoria->alocar(quantidade * sizeof(Type), alignof(Type)));
+  }
+
+  void deallocate(Type* ponteiro, size_t quantidade) noexcept {
+    memoria->liberar(ponteiro, quantidade * sizeof(Type), alignof(Type));
+  }
+
+  template <typename Outro>
+  bool operator==(const PoolAllocator<Outro>& outro) const noexcept {
+    return memoria == outro.memoria;
+  }
+
+  template <typename Outro>
+  bool operator!=(const PoolAllocator<Outro>& outro) const noexcept {
+    return memoria != outro.memoria;
+  }
+
+ private:
+  PoolMemoria* memoria;
+
+  template <typename Outro>
+  friend class PoolAllocator;
+};
+
+inline PoolMemoria::PoolMemoria()
+    : livres(), blocos(nullptr), atual(nullptr), limite(nullptr), reservados(0) {}
+
+inline PoolMemoria::~PoolMemoria() {
+  while (blocos != nullptr) {
+    Bloco* anterior = blocos->anterior;
+    ::operator delete(blocos);
+    blocos = anterior;
+  }
+}
+
+inline size_t PoolMemoria::classe(size_t bytes) {
+  return bytes == 0 ? 0 : (bytes - 1) / ALINHAMENTO;
+}
+
+inline void* PoolMemoria::alocar(size_t bytes, size_t alinhamento) {
+  if (alinhamento > ALINHAMENTO) {
+    return ::operator new(bytes, std::align_val_t(alinhamento));
+  }
+  if (bytes > TAMANHO_MAXIMO) return ::operator new(bytes);
+
+  size_t indice = classe(bytes);
+  if (livres[indice] != nullptr) {
+    Livre* livre = livres[indice];
+    livres[indice] = livre->proximo;
+    return livre;
+  }
+
+  size_t tamanho = (indice + 1) * ALINHAMENTO;
+  if (static_cast<size_t>(limite - atual) < tamanho) {
+    // O resto do bloco anterior (menor que uma posição) é descartado
+    Bloco* bloco = static_cast<Bloco*>(::operator new(TAMANHO_BLOCO));
+    bloco->anterior = blocos;
+    blocos = bloco;
+    reservados += TAMANHO_BLOCO;
+
+    atual = reinterpret_cast<char*>(bloco + 1);
+    limite = reinterpret_cast<char*>(bloco) + TAMANHO_BLOCO;
+  }
+
+  void* posicao = atual;
+  atual += tamanho;
+  return posicao;
+}
+
+inline void PoolMemoria::liberar(void* ponteiro, size_t bytes, size_t alinhamento) {
+  if (ponteiro == nullptr) return;
+
+  if (alinhamento > ALINHAMENTO) {
+    ::operator delete(ponteiro, std::align_val_t(alinhamento));
+    return;
+  }
+  if (bytes > TAMANHO_MAXIMO) {
+    ::operator delete(ponteiro);
+    return;
+  }
+
+  size_t indice = classe(bytes);
+  Livre* livre = static_cast<Livre*>(ponteiro);
+  livre->proximo = livres[indice];
+  livres[indice] = livre;
+}
+
+inline size_t PoolMemoria::reservado() const {
+  return reservados;
+}
+
+inline PoolMemoria& PoolMemoria::daThread() {
+  static thread_local PoolMemoria* memoria = new PoolMemoria();
+  return *memoria;
+}
+
+#endif
@@ -0,0 +1,398 @@
+#ifndef AVLTREE_HPP
+#define AVLTREE_HPP
+
+#include <algorithm>
+#include <iostream>
+
+/**
+ * @brief Árvore binária de busca auto-balanceada (AVL)
+ *
+ * Possui a mesma interface da `BinSearchTree`, mas cada nó guarda a altura da sua subárvore e,
+ * após cada inserção ou remoção, os nós do caminho percorrido são rebalanceados com rotações.
+ * Assim a altura da árvore fica sempre abaixo de ~1.44 log2(n), e `insert`, `search` e `remove`
+ * custam O(log n) independentemente da ordem em que os valores chegam.
+ *
+ * Como a altura é logarítmica, os métodos auxiliares podem ser recursivos sem risco de estourar a
+ * pilha de chamadas.
+ *
+ * @tparam Type
+ */
+template <typename Type>
+class AVLTree {
+ private:
+  struct Node {
+    Type valor;
+    Node* left;
+    Node* right;
+
+    /**
+     * @brief Altura da subárvore cuja raiz é este nó (uma folha tem altura 1)
+     *
+     */
+    int altura;
+
+    Node(Type valor) : valor(valor), left(nullptr), right(nullptr), altura(1) {}
+  };
+
+  Node* raiz;
+
+  /**
+   * @brief Número de nós da árvore
+   *
+   */
+  size_t tamanho;
+
+ public:
+  AVLTree() : raiz(nullptr), tamanho(0) {}
+  AVLTree(const AVLTree<Type>& outraArvore);
+  AVLTree<Type>& operator=(const AVLTree<Type>&) = delete;
+  ~AVLTree();
+
+  /**
+   * @brief Insere um valor na árvore e rebalanceia o caminho da inserção.
+   *
+   * Valores iguais a um valor existente são adicionados à subárvore direita, como na
+   * `BinSearchTree`.
+   *
+   * @param valor O valor a ser inserido na árvore.
+   */
+  void insert(Type valor);
+
+  /**
+   * @brief Remove uma ocorrência de um valor da árvore e rebalanceia o caminho da remoção.
+   *
+   * @param valor O valor a ser removido
+   * @return true se o valor estava na árvore
+   */
+  bool remove(Type valor);
+
+  /**
+   * @brief Percorre a árvore em pré-ordem (pre-order) e imprime os valores.
+   *
+   */
+  void preOrder() const;
+
+  /**
+   * @brief Percorre a árvore em ordem (in-order) e imprime os valores.
+   *
+   */
+  void inOrder() const;
+
+  /**
+   * @brief Percorre a árvore em pós-ordem (post-order) e imprime os valores.
+   *
+   */
+  void postOrder() const;
+
+  /**
+   * @brief Verifica se um valor específico está presente na árvore.
+   *
+   * @param valor O valor a ser buscado na árvore
+   */
+  bool search(Type valor) const;
+
+  /**
+   * @brief Retorna a altura da árvore (O(1), lida da raiz)
+   *
+   * @return size_t
+   */
+  size_t height() const;
+
+  /**
+   * @brief Retorna a quantidade de nós da árvore (O(1))
+   *
+   * @return size_t
+   */
+  size_t countNodes() const;
+
+  /**
+   * @brief Retorna se a árvore está ou não balanceada
+   *
+   * Toda inserção e remoção restaura o fator de balanceamento dos nós do caminho alterado, então o
+   * invariante AVL vale em todos os nós. A resposta é obtida em O(1) a partir das alturas
+   * armazenadas nos filhos da raiz.
+   */
+  bool isBalanced() const;
+
+ private:
+  static int altura(const Node* node);
+  static int fatorBalanceamento(const Node* node);
+  static void atualizarAltura(Node* node);
+
+  /**
+   * @brief Rotação simples à direita; o filho esquerdo se torna a nova raiz da subárvore
+   *
+   * @return Node* Nova raiz da subárvore
+   */
+  static Node* rotacaoDireita(Node* node);
+
+  /**
+   * @brief Rotação simples à esquerda; o filho direito se torna a nova raiz da subárvore
+   *
+   * @return Node* Nova raiz da subárvore
+   */
+  static Node* rotacaoEsquerda(Node* node);
+
+  /**
+   * @brief Atualiza a altura do nó e aplica a rotação (simples ou dupla) necessária
+   *
+   * @return Node* Nova raiz da subárvore
+   */
+  static Node* balancear(Node* node);
+
+  Node* insert(Node* node, Type valor);
+  Node* remove(Node* node, const Type& valor, bool& removido);
+
+  /**
+   * @brief Desliga o menor nó da subárvore e retorna a nova raiz dela
+   *
+   * @param node Raiz da subárvore
+   * @param minimo Recebe o nó desligado
+   */
+  Node* removerMinimo(Node* node, Node*& minimo);
+
+  static Node* copiar(const Node* node);
+  static void destruir(Node* node);
+
+  void preOrder(const Node* node) const;
+  void inOrder(const Node* node) const;
+  void postOrder(const Node* node) const;
+};
+
+template <typename Type>
+AVLTree<Type>::AVLTree(const AVLTree<Type>& outraArvore)
+    : raiz(copiar(outraArvore.raiz)), tamanho(outraArvore.tamanho) {}
+
+template <typename Type>
+AVLTree<Type>::~AVLTree() {
+  destruir(raiz);
+}
+
+template <typename Type>
+typename AVLTree<Type>::Node* AVLTree<Type>::copiar(const typename AVLTree<Type>::Node* node) {
+  if (node == nullptr) return nullptr;
+
+  // A cópia reproduz a estrutura nó a nó, sem precisar rebalancear
+  Node* novo = new Node(node->valor);
+  novo->altura = node->altura;
+  novo->left = copiar(node->left);
+  novo->right = copiar(node->right);
+  return novo;
+}
+
+template <typename Type>
+void AVLTree<Type>::destruir(typename AVLTree<Type>::Node* node) {
+  if (node == nullptr) return;
+
+  destruir(node->left);
+  destruir(node->right);
+  delete node;
+}
+
+template <typename Type>
+int AVLTree<Type>::altura(const typename AVLTree<Type>::Node* node) {
+  return node == nullptr ? 0 : node->altura;
+}
+
+template <typename Type>
+int AVLTree<Type>::fatorBalanceamento(const typename AVLTree<Type>::Node* node) {
+  return node == nullptr ? 0 : altura(node->left) - altura(node->right);
+}
+
+template <typename Type>
+void AVLTree<Type>::atualizarAltura(typename AVLTree<Type>::Node* node) {
+  node->altura = 1 + std::max(altura(node->left), altura(node->right));
+}
+
+template <typename Type>
+typename AVLTree<Type>::Node* AVLTree<Type>::rotacaoDireita(typename AVLTree<Type>::Node* node) {
+  Node* esquerdo = node->left;
+  node->left = esquerdo->right;
+  esquerdo->right = node;
+
+  atualizarAltura(node);
+  atualizarAltura(esquerdo);
+  return esquerdo;
+}
+
+template <typename Type>
+typename AVLTree<Type>::Node* AVLTree<Type>::rotacaoEsquerda(typename AVLTree<Type>::Node* node) {
+  Node* direito = node->right;
+  node->right = direito->left;
+  direito->left = node;
+
+  atualizarAltura(node);
+  atualizarAltura(direito);
+  return direito;
+}
+
+template <typename Type>
+typename AVLTree<Type>::Node* AVLTree<Type>::balancear(typename AVLTree<Type>::Node* node) {
+  atualizarAltura(node);
+  int fator = fatorBalanceamento(node);
+
+  if (fator > 1) {  // Pesado à esquerda
+    if (fatorBalanceamento(node->left) < 0) {
+      node->left = rotacaoEsquerda(node->left);  // Caso esquerda-direita
+    }
+    return rotacaoDireita(node);
+  }
+
+  if (fator < -1) {  // Pesado à direita
+    if (fatorBalanceamento(node->right) > 0) {
+      node->right = rotacaoDireita(node->right);  // Caso direita-esquerda
+    }
+    return rotacaoEsquerda(node);
+  }
+
+  return node;
+}
+
+template <typename Type>
+void AVLTree<Type>::insert(Type valor) {
+  raiz = insert(raiz, valor);
+  ++tamanho;
+}
+
+template <typename Type>
+typename AVLTree<Type>::Node* AVLTree<Type>::insert(typename AVLTree<Type>::Node* node,
+                                                    Type valor) {
+  if (node == nullptr) {
+    return new Node(valor);
+  }
+
+  if (valor < node->valor) {
+    node->left = insert(node->left, valor);
+  } else {
+    node->right = insert(node->right, valor);
+  }
+
+  return balancear(node);
+}
+
+template <typename Type>
+bool AVLTree<Type>::remove(Type valor) {
+  bool removido = false;
+  raiz = remove(raiz, valor, removido);
+
+  if (removido) --tamanho;
+  return removido;
+}
+
+template <typename Type>
+typename AVLTree<Type>::Node* AVLTree<Type>::remove(typename AVLTree<Type>::Node* node,
+                                                    const Type& valor, bool& removido) {
+  if (node == nullptr) return nullptr;
+
+  if (valor < node->valor) {
+    node->left = remove(node->left, valor, removido);
+  } else if (node->valor < valor) {
+    node->right = remove(node->right, valor, removido);
+  } else {
+    removido = true;
+
+    if (node->left == nullptr || node->right == nullptr) {
+      Node* filho = node->left != nullptr ? node->left : node->right;
+      delete node;
+      return filho;
+    }
+
+    // Dois filhos: o sucessor (menor nó da subárvore direita) ocupa o lugar do nó removido
+    Node* sucessor;
+    Node* direito = removerMinimo(node->right, sucessor);
+    sucessor->left = node->left;
+    sucessor->right = direito;
+    delete node;
+    return balancear(sucessor);
+  }
+
+  return balancear(node);
+}
+
+template <typename Type>
+typename AVLTree<Type>::Node* AVLTree<Type>::removerMinimo(typename AVLTree<Type>::Node* node,
+                                                           typename AVLTree<Type>::Node*& minimo) {
+  if (node->left == nullptr) {
+    minimo = node;
+    return node->right;
+  }
+
+  node->left = removerMinimo(node->left, minimo);
+  return balancear(node);
+}
+
+template <typename Type>
+bool AVLTree<Type>::search(Type valor) const {
+  const Node* atual = raiz;
+
+  while (atual != nullptr) {
+    if (atual->valor == valor) return true;
+
+    atual = valor < atual->valor ? atual->left : atual->right;
+  }
+
+  return false;
+}
+
+template <typename Type>
+void AVLTree<Type>::preOrder() const {
+  preOrder(raiz);
+  std::cout << std::endl;
+}
+
+template <typename Type>
+void AVLTree<Type>::preOrder(const typename AVLTree<Type>::Node* node) const {
+  if (node == nullptr) return;
+
+  std::cout << node->valor << " ";
+  preOrder(node->left);
+  preOrder(node->right);
+}
+
+template <typename Type>
+void AVLTree<Type>::inOrder() const {
+  inOrder(raiz);
+  std::cout << std::endl;
+}
+
+template <typename Type>
+void AVLTree<Type>::inOrder(const typename AVLTree<Type>::Node* node) const {
+  if (node == nullptr) return;
+
+  inOrder(node->left);
+  std::cout << node->valor << " ";
+  inOrder(node->right);
+}
+
+template <typename Type>
+void AVLTree<Type>::postOrder() const {
+  postOrder(raiz);
+  std::cout << std::endl;
+}
+
+template <typename Type>
+void AVLTree<Type>::postOrder(const typename AVLTree<Type>::Node* node) const {
+  if (node == nullptr) return;
+
+  postOrder(node->left);
+  postOrder(node->right);
+  std::cout << node->valor << " ";
+}
+
+template <typename Type>
+size_t AVLTree<Type>::height() const {
+  return static_cast<size_t>(altura(raiz));
+}
+
+template <typename Type>
+size_t AVLTree<Type>::countNodes() const {
+  return tamanho;
+}
+
+template <typename Type>
+bool AVLTree<Type>::isBalanced() const {
+  int fator = fatorBalanceamento(raiz);
+  return fator >= -1 && fator <= 1;
+}
+
+#endif
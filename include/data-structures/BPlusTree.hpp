@@ -0,0 +1,536 @@
+#ifndef BPLUSTREE_HPP
+#define BPLUSTREE_HPP
+
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief Árvore B+ ordenada com folhas encadeadas
+ *
+ * Cada nó guarda até `Ordem` chaves em um vetor contíguo, então uma busca faz uma falta de cache
+ * por nível (e o nível tem `Ordem` vezes mais chaves que um nó binário). Todas as chaves ficam nas
+ * folhas; os nós internos guardam apenas separadores. As folhas são encadeadas da menor para a
+ * maior chave, o que torna o percurso em ordem e as buscas por intervalo sequenciais.
+ *
+ * A interface de inserção, busca e percursos é a mesma da `BinSearchTree`. Valores repetidos são
+ * permitidos e ficam depois dos valores iguais já existentes.
+ *
+ * @tparam Type
+ * @tparam Ordem Número máximo de chaves por nó. O padrão ocupa cerca de 256 bytes (4 linhas de
+ * cache) de chaves por nó
+ */
+template <typename Type, size_t Ordem = (sizeof(Type) >= 64 ? 4 : 256 / sizeof(Type))>
+class BPlusTree {
+  static_assert(Ordem >= 3, "A ordem da arvore deve ser pelo menos 3");
+
+ private:
+  struct No {
+    bool folha;
+
+    /**
+     * @brief Quantidade de chaves em uso
+     *
+     */
+    size_t quantidade;
+
+    /**
+     * @brief Chaves do nó (a posição extra recebe a chave que causa a divisão do nó)
+     *
+     */
+    Type chaves[Ordem + 1];
+
+    explicit No(bool folha) : folha(folha), quantidade(0) {}
+  };
+
+  struct Interno : No {
+    /**
+     * @brief Filhos do nó: o filho `i` guarda as chaves entre `chaves[i - 1]` e `chaves[i]`
+     *
+     */
+    No* filhos[Ordem + 2];
+
+    Interno() : No(false) {}
+  };
+
+  struct Folha : No {
+    /**
+     * @brief Aponta para a próxima folha (com chaves maiores)
+     *
+     */
+    Folha* proxima;
+
+    Folha() : No(true), proxima(nullptr) {}
+  };
+
+  No* raiz;
+
+  /**
+   * @brief Quantidade de valores na árvore
+   *
+   */
+  size_t tamanho;
+
+  /**
+   * @brief Número de níveis da árvore (todas as folhas ficam no mesmo nível)
+   *
+   */
+  size_t altura;
+
+  size_t quantidadeFolhas;
+  size_t quantidadeInternos;
+
+ public:
+  BPlusTree()
+      : raiz(nullptr), tamanho(0), altura(0), quantidadeFolhas(0), quantidadeInternos(0) {}
+  BPlusTree(const BPlusTree<Type, Ordem>& outraArvore);
+  BPlusTree<Type, Ordem>& operator=(const BPlusTree<Type, Ordem>&) = delete;
+  ~BPlusTree();
+
+  /**
+   * @brief Insere um valor na árvore.
+   *
+   * O valor é inserido na folha correspondente; se ela ficar com mais de `Ordem` chaves, é
+   * dividida ao meio e um separador sobe para o pai (o que pode dividir os ancestrais e criar uma
+   * nova raiz).
+   *
+   * @param valor O valor a ser inserido na árvore.
+   */
+  void insert(Type valor);
+
+  /**
+   * @brief Substitui o conteúdo da árvore pelos valores (já ordenados) de `[primeiro, ultimo)`.
+   *
+   * As folhas são preenchidas em sequência e os níveis internos são construídos de baixo para
+   * cima, em O(n), sem nenhuma divisão de nós.
+   *
+   * @throw `std::invalid_argument` se os valores não estiverem ordenados
+   */
+  template <typename Iterador>
+  void bulkLoad(Iterador primeiro, Iterador ultimo);
+
+  /**
+   * @brief Verifica se um valor específico está presente na árvore.
+   *
+   * @param valor O valor a ser buscado na árvore
+   */
+  bool search(Type valor) const;
+
+  /**
+   * @brief Chama `funcao` para cada valor em `[menor, maior]`, em ordem crescente.
+   *
+   * Desce até a primeira folha do intervalo e depois segue o encadeamento das folhas.
+   *
+   * @return size_t Quantidade de valores visitados
+   */
+  template <typename Funcao>
+  size_t range(const Type& menor, const Type& maior, Funcao funcao) const;
+
+  /**
+   * @brief Percorre os nós em pré-ordem e imprime as chaves de cada nó entre colchetes.
+   *
+   */
+  void preOrder() const;
+
+  /**
+   * @brief Imprime todos os valores em ordem crescente (percorrendo as folhas encadeadas).
+   *
+   */
+  void inOrder() const;
+
+  /**
+   * @brief Percorre os nós em pós-ordem e imprime as chaves de cada nó entre colchetes.
+   *
+   */
+  void postOrder() const;
+
+  /**
+   * @brief Retorna a altura da árvore (número de níveis)
+   *
+   * @return size_t
+   */
+  size_t height() const;
+
+  /**
+   * @brief Retorna a quantidade de valores na árvore
+   *
+   * @return size_t
+   */
+  size_t countNodes() const;
+
+  /**
+   * @brief Retorna quantos bytes os nós da árvore ocupam
+   *
+   * Não inclui o espaço desperdiçado pelo alocador em cada alocação.
+   * @return size_t
+   */
+  size_t memoryUsage() const;
+
+ private:
+  /**
+   * @brief Insere o valor na subárvore de `node`
+   *
+   * @param separador Recebe a chave que deve subir para o pai, se o nó for dividido
+   * @param novoIrmao Recebe o nó criado pela divisão (ou `nullptr` se não houve divisão)
+   */
+  void insert(No* node, const Type& valor, Type& separador, No*& novoIrmao);
+
+  /**
+   * @brief Desce até a folha que contém o primeiro valor maior ou igual a `valor`
+   *
+   * @param posicao Recebe a posição desse valor na folha retornada
+   * @return Folha* `nullptr` se todos os valores da árvore forem menores
+   */
+  const Folha* lowerBound(const Type& valor, size_t& posicao) const;
+
+  /**
+   * @brief Retorna a folha mais à esquerda (a que contém o menor valor)
+   *
+   */
+  const Folha* primeiraFolha() const;
+
+  void destruir(No* node);
+  void preOrder(const No* node) const;
+  void postOrder(const No* node) const;
+  static void imprimirNo(const No* node);
+};
+
+template <typename Type, size_t Ordem>
+BPlusTree<Type, Ordem>::BPlusTree(const BPlusTree<Type, Ordem>& outraArvore) : BPlusTree() {
+  // As folhas da outra árvore já estão em ordem, então a cópia é uma carga em lote, em O(n)
+  std::vector<Type> valores;
+  valores.reserve(outraArvore.tamanho);
+
+  for (const Folha* folha = outraArvore.primeiraFolha(); folha != nullptr; folha = folha->proxima) {
+    valores.insert(valores.end(), folha->chaves, folha->chaves + folha->quantidade);
+  }
+
+  bulkLoad(valores.begin(), valores.end());
+}
+
+template <typename Type, size_t Ordem>
+BPlusTree<Type, Ordem>::~BPlusTree() {
+  destruir(raiz);
+}
+
+template <typename Type, size_t Ordem>
+void BPlusTree<Type, Ordem>::destruir(typename BPlusTree<Type, Ordem>::No* node) {
+  if (node == nullptr) return;
+
+  if (node->folha) {
+    delete static_cast<Folha*>(node);
+    return;
+  }
+
+  // A altura é logarítmica (e pequena, pois cada nó tem muitos filhos), então a recursão é segura
+  Interno* interno = static_cast<Interno*>(node);
+  for (size_t i = 0; i <= interno->quantidade; ++i) {
+    destruir(interno->filhos[i]);
+  }
+  delete interno;
+}
+
+template <typename Type, size_t Ordem>
+const typename BPlusTree<Type, Ordem>::Folha* BPlusTree<Type, Ordem>::primeiraFolha() const {
+  const No* atual = raiz;
+  if (atual == nullptr) return nullptr;
+
+  while (!atual->folha) {
+    atual = static_cast<const Interno*>(atual)->filhos[0];
+  }
+  return static_cast<const Folha*>(atual);
+}
+
+template <typename Type, size_t Ordem>
+void BPlusTree<Type, Ordem>::insert(Type valor) {
+  if (raiz == nullptr) {
+    raiz = new Folha();
+    altura = 1;
+    ++quantidadeFolhas;
+  }
+
+  Type separador;
+  No* novoIrmao;
+  insert(raiz, valor, separador, novoIrmao);
+  ++tamanho;
+
+  // A raiz foi dividida: a árvore cresce um nível para cima
+  if (novoIrmao != nullptr) {
+    Interno* novaRaiz = new Interno();
+    novaRaiz->chaves[0] = separador;
+    novaRaiz->filhos[0] = raiz;
+    novaRaiz->filhos[1] = novoIrmao;
+    novaRaiz->quantidade = 1;
+
+    raiz = novaRaiz;
+    ++altura;
+    ++quantidadeInternos;
+  }
+}
+
+template <typename Type, size_t Ordem>
+void BPlusTree<Type, Ordem>::insert(typename BPlusTree<Type, Ordem>::No* node, const Type& valor,
+                                    Type& separador,
+                                    typename BPlusTree<Type, Ordem>::No*& novoIrmao) {
+  novoIrmao = nullptr;
+  Type* chaves = node->chaves;
+
+  // Valores iguais ficam depois dos já existentes
+  size_t posicao = std::upper_bound(chaves, chaves + node->quantidade, valor) - chaves;
+
+  if (node->folha) {
+    Folha* folha = static_cast<Folha*>(node);
+    std::move_backward(chaves + posicao, chaves + folha->quantidade,
+                       chaves + folha->quantidade + 1);
+    chaves[posicao] = valor;
+    ++folha->quantidade;
+
+    if (folha->quantidade <= Ordem) return;
+
+    // A folha passou de `Ordem` chaves: a metade superior vai para uma nova folha, logo à direita
+    Folha* nova = new Folha();
+    ++quantidadeFolhas;
+
+    size_t metade = folha->quantidade / 2;
+    std::move(chaves + metade, chaves + folha->quantidade, nova->chaves);
+    nova->quantidade = folha->quantidade - metade;
+    folha->quantidade = metade;
+
+    nova->proxima = folha->proxima;
+    folha->proxima = nova;
+
+    // Nas folhas o separador é copiado: a menor chave da nova folha continua nela
+    separador = nova->chaves[0];
+    novoIrmao = nova;
+    return;
+  }
+
+  Interno* interno = static_cast<Interno*>(node);
+  Type separadorFilho;
+  No* novoFilho;
+  insert(interno->filhos[posicao], valor, separadorFilho, novoFilho);
+
+  if (novoFilho == nullptr) return;
+
+  // O filho foi dividido: o separador e o novo filho entram logo depois do filho original
+  std::move_backward(chaves + posicao, chaves + interno->quantidade,
+                     chaves + interno->quantidade + 1);
+  std::move_backward(interno->filhos + posicao + 1, interno->filhos + interno->quantidade + 1,
+                     interno->filhos + interno->quantidade + 2);
+  chaves[posicao] = separadorFilho;
+  interno->filhos[posicao + 1] = novoFilho;
+  ++interno->quantidade;
+
+  if (interno->quantidade <= Ordem) return;
+
+  // Nos nós internos a chave do meio sobe para o pai e não fica em nenhuma das metades
+  Interno* novo = new Interno();
+  ++quantidadeInternos;
+
+  size_t metade = interno->quantidade / 2;
+  std::move(chaves + metade + 1, chaves + interno->quantidade, novo->chaves);
+  std::copy(interno->filhos + metade + 1, interno->filhos + interno->quantidade + 1, novo->filhos);
+  novo->quantidade = interno->quantidade - metade - 1;
+  interno->quantidade = metade;
+
+  separador = chaves[metade];
+  novoIrmao = novo;
+}
+
+template <typename Type, size_t Ordem>
+template <typename Iterador>
+void BPlusTree<Type, Ordem>::bulkLoad(Iterador primeiro, Iterador ultimo) {
+  // Preenche as folhas completamente, na ordem dos valores
+  std::vector<No*> nivel;
+  std::vector<Type> menores;
+  Folha* anterior = nullptr;
+  size_t quantidade = 0;
+
+  for (; primeiro != ultimo; ++primeiro, ++quantidade) {
+    if (anterior != nullptr && *primeiro < anterior->chaves[anterior->quantidade - 1]) {
+      for (No* folha : nivel) delete static_cast<Folha*>(folha);
+      throw std::invalid_argument("Os valores da carga em lote devem estar ordenados");
+    }
+
+    if (anterior == nullptr || anterior->quantidade == Ordem) {
+      Folha* nova = new Folha();
+      if (anterior != nullptr) anterior->proxima = nova;
+
+      nivel.push_back(nova);
+      menores.push_back(*primeiro);
+      anterior = nova;
+    }
+
+    anterior->chaves[anterior->quantidade++] = *primeiro;
+  }
+
+  destruir(raiz);
+  raiz = nullptr;
+  tamanho = quantidade;
+  altura = nivel.empty() ? 0 : 1;
+  quantidadeFolhas = nivel.size();
+  quantidadeInternos = 0;
+
+  // Constrói cada nível interno a partir do nível de baixo, distribuindo os filhos igualmente
+  // (assim todo nó interno fica com pelo menos dois filhos)
+  while (nivel.size() > 1) {
+    size_t pais = (nivel.size() + Ordem) / (Ordem + 1);
+    std::vector<No*> proximoNivel;
+    std::vector<Type> proximosMenores;
+    proximoNivel.reserve(pais);
+    proximosMenores.reserve(pais);
+
+    size_t filho = 0;
+    for (size_t i = 0; i < pais; ++i) {
+      size_t filhos = nivel.size() / pais + (i < nivel.size() % pais ? 1 : 0);
+
+      Interno* interno = new Interno();
+      interno->filhos[0] = nivel[filho];
+      for (size_t j = 1; j < filhos; ++j) {
+        // O separador é o menor valor da subárvore à direita dele
+        interno->chaves[j - 1] = menores[filho + j];
+        interno->filhos[j] = nivel[filho + j];
+      }
+      interno->quantidade = filhos - 1;
+
+      proximoNivel.push_back(interno);
+      proximosMenores.push_back(menores[filho]);
+      filho += filhos;
+    }
+
+    quantidadeInternos += pais;
+    ++altura;
+    nivel.swap(proximoNivel);
+    menores.swap(proximosMenores);
+  }
+
+  if (!nivel.empty()) raiz = nivel[0];
+}
+
+template <typename Type, size_t Ordem>
+const typename BPlusTree<Type, Ordem>::Folha* BPlusTree<Type, Ordem>::lowerBound(
+    const Type& valor, size_t& posicao) const {
+  const No* atual = raiz;
+  if (atual == nullptr) return nullptr;
+
+  // A descida usa o primeiro separador maior ou igual ao valor, então tudo o que fica à esquerda
+  // do caminho é menor que o valor
+  while (!atual->folha) {
+    const Type* chaves = atual->chaves;
+    size_t filho = std::lower_bound(chaves, chaves + atual->quantidade, valor) - chaves;
+    atual = static_cast<const Interno*>(atual)->filhos[filho];
+  }
+
+  const Folha* folha = static_cast<const Folha*>(atual);
+  const Type* chaves = folha->chaves;
+  posicao = std::lower_bound(chaves, chaves + folha->quantidade, valor) - chaves;
+
+  // Se todos os valores da folha forem menores, o primeiro maior ou igual é o início da próxima
+  if (posicao == folha->quantidade) {
+    folha = folha->proxima;
+    posicao = 0;
+  }
+  return folha;
+}
+
+template <typename Type, size_t Ordem>
+bool BPlusTree<Type, Ordem>::search(Type valor) const {
+  size_t posicao;
+  const Folha* folha = lowerBound(valor, posicao);
+
+  return folha != nullptr && folha->chaves[posicao] == valor;
+}
+
+template <typename Type, size_t Ordem>
+template <typename Funcao>
+size_t BPlusTree<Type, Ordem>::range(const Type& menor, const Type& maior, Funcao funcao) const {
+  size_t posicao;
+  size_t visitados = 0;
+
+  for (const Folha* folha = lowerBound(menor, posicao); folha != nullptr; folha = folha->proxima) {
+    for (; posicao < folha->quantidade; ++posicao) {
+      if (maior < folha->chaves[posicao]) return visitados;
+
+      funcao(folha->chaves[posicao]);
+      ++visitados;
+    }
+    posicao = 0;
+  }
+
+  return visitados;
+}
+
+template <typename Type, size_t Ordem>
+void BPlusTree<Type, Ordem>::imprimirNo(const typename BPlusTree<Type, Ordem>::No* node) {
+  std::cout << "[";
+  for (size_t i = 0; i < node->quantidade; ++i) {
+    std::cout << (i > 0 ? " " : "") << node->chaves[i];
+  }
+  std::cout << "] ";
+}
+
+template <typename Type, size_t Ordem>
+void BPlusTree<Type, Ordem>::preOrder() const {
+  preOrder(raiz);
+  std::cout << std::endl;
+}
+
+template <typename Type, size_t Ordem>
+void BPlusTree<Type, Ordem>::preOrder(const typename BPlusTree<Type, Ordem>::No* node) const {
+  if (node == nullptr) return;
+
+  imprimirNo(node);
+  if (node->folha) return;
+
+  const Interno* interno = static_cast<const Interno*>(node);
+  for (size_t i = 0; i <= interno->quantidade; ++i) {
+    preOrder(interno->filhos[i]);
+  }
+}
+
+template <typename Type, size_t Ordem>
+void BPlusTree<Type, Ordem>::inOrder() const {
+  for (const Folha* folha = primeiraFolha(); folha != nullptr; folha = folha->proxima) {
+    for (size_t i = 0; i < folha->quantidade; ++i) {
+      std::cout << folha->chaves[i] << " ";
+    }
+  }
+  std::cout << std::endl;
+}
+
+template <typename Type, size_t Ordem>
+void BPlusTree<Type, Ordem>::postOrder() const {
+  postOrder(raiz);
+  std::cout << std::endl;
+}
+
+template <typename Type, size_t Ordem>
+void BPlusTree<Type, Ordem>::postOrder(const typename BPlusTree<Type, Ordem>::No* node) const {
+  if (node == nullptr) return;
+
+  if (!node->folha) {
+    const Interno* interno = static_cast<const Interno*>(node);
+    for (size_t i = 0; i <= interno->quantidade; ++i) {
+      postOrder(interno->filhos[i]);
+    }
+  }
+  imprimirNo(node);
+}
+
+template <typename Type, size_t Ordem>
+size_t BPlusTree<Type, Ordem>::height() const {
+  return altura;
+}
+
+template <typename Type, size_t Ordem>
+size_t BPlusTree<Type, Ordem>::countNodes() const {
+  return tamanho;
+}
+
+template <typename Type, size_t Ordem>
+size_t BPlusTree<Type, Ordem>::memoryUsage() const {
+  return quantidadeFolhas * sizeof(Folha) + quantidadeInternos * sizeof(Interno);
+}
+
+#endif
@@ -2,14 +2,29 @@
 #define BINTREE_HPP
 
 #include <algorithm>
+#include <cstddef>
+#include <deque>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../algorithms/WorkStealingPool.hpp"
+#include "../allocators/AlocadorMonotonico.hpp"
+#include "EytzingerTree.hpp"
+#include "PilhaContigua.hpp"
 
 /**
  * @brief Árvore binária de busca
  *
  * @tparam Type
+ * @tparam Allocator Alocador usado para os blocos de nós (por exemplo, `ArenaAllocator`)
  */
-template <typename Type>
+template <typename Type, typename Allocator = std::allocator<Type>>
 class BinSearchTree {
  private:
   struct Node {
@@ -17,27 +32,258 @@ class BinSearchTree {
     Node* left;
     Node* right;
 
-    Node(Type valor) : valor(valor), left(nullptr), right(nullptr) {}
+    /**
+     * @brief Aponta para o pai do nó (`nullptr` na raiz), usado pelos iteradores
+     *
+     */
+    Node* pai;
+
+    /**
+     * @brief Quantidade de nós da subárvore cuja raiz é este nó (incluindo ele mesmo)
+     *
+     */
+    size_t tamanho;
+
+    /**
+     * @brief Altura da subárvore cuja raiz é este nó (uma folha tem altura 1)
+     *
+     */
+    size_t altura;
+
+    /**
+     * @brief Indica se as alturas das subárvores esquerda e direita diferem em mais de 1
+     *
+     */
+    bool desbalanceado;
+
+    Node(Type valor)
+        : valor(valor),
+          left(nullptr),
+          right(nullptr),
+          pai(nullptr),
+          tamanho(1),
+          altura(1),
+          desbalanceado(false) {}
   };
 
+  /**
+   * @brief Bloco contíguo de nós; os nós ficam logo depois do cabeçalho, na mesma alocação
+   *
+   */
+  struct alignas(alignof(Node)) Bloco {
+    Bloco* anterior;
+    size_t capacidade;
+    size_t usados;
+
+    Node* nos() { return reinterpret_cast<Node*>(this + 1); }
+  };
+
+  /**
+   * @brief Os blocos são alocados como vetores de `Bloco`: o primeiro é o cabeçalho e os demais
+   * guardam os nós
+   *
+   */
+  using AlocadorBloco = typename std::allocator_traits<Allocator>::template rebind_alloc<Bloco>;
+  using TraitsBloco = std::allocator_traits<AlocadorBloco>;
+
+  /**
+   * @brief Capacidade (em nós) dos blocos alocados pelo `insert`
+   *
+   * O novo bloco acompanha o tamanho da árvore, dentro destes limites.
+   */
+  static constexpr size_t CAPACIDADE_MINIMA = 32;
+  static constexpr size_t CAPACIDADE_MAXIMA = 1 << 16;
+
+  /**
+   * @brief Quantidade de buscas intercaladas por `search_batch`
+   *
+   */
+  static constexpr size_t BUSCAS_SIMULTANEAS = 16;
+
+  /**
+   * @brief Subárvores com até esta quantidade de nós são processadas por uma única tarefa nas
+   * operações paralelas
+   *
+   */
+  static constexpr size_t GRAO_PARALELO = 4096;
+
   Node* raiz;
 
+  /**
+   * @brief Bloco mais recente (os demais são encadeados por `anterior`)
+   *
+   */
+  Bloco* blocos;
+
+  /**
+   * @brief Nós liberados por `remove`, reaproveitados pelos próximos `insert`
+   *
+   * O endereço do próximo nó livre é guardado no espaço do próprio nó.
+   */
+  Node* livres;
+
+  /**
+   * @brief Quantidade de nós marcados como desbalanceados
+   *
+   * Mantida por `insert` e `remove`, permite responder `isBalanced` sem percorrer a árvore.
+   */
+  size_t desbalanceados;
+
+  AlocadorBloco alocador;
+
+  /**
+   * @brief Pilha explícita utilizada pelos percursos no lugar da pilha de chamadas.
+   *
+   * Como a árvore não é balanceada, sua altura pode chegar ao número de nós (por exemplo, ao
+   * inserir valores já ordenados). Percursos recursivos estourariam a pilha de chamadas nesses
+   * casos, então todos os percursos usam esta pilha, que cresce no heap.
+   */
+  using PilhaNos = PilhaContigua<const Node*, 64>;
+
  public:
-  BinSearchTree() : raiz(nullptr) {}
-  BinSearchTree(const BinSearchTree<Type>& outraArvore);
+  /**
+   * @brief Iterador bidirecional que percorre os valores em ordem crescente
+   *
+   * Anda pela árvore usando os ponteiros para o pai, sem recursão e sem alocar memória. Os valores
+   * não podem ser alterados pelo iterador, pois isso quebraria a ordem da árvore. `insert` não
+   * invalida iteradores; `remove` invalida os iteradores do valor removido e do seu sucessor.
+   */
+  class const_iterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Type*;
+    using reference = const Type&;
+
+    const_iterator() : node(nullptr), arvore(nullptr) {}
+
+    reference operator*() const { return node->valor; }
+    pointer operator->() const { return &node->valor; }
+
+    const_iterator& operator++();
+    const_iterator operator++(int);
+    const_iterator& operator--();
+    const_iterator operator--(int);
+
+    bool operator==(const const_iterator& outro) const { return node == outro.node; }
+    bool operator!=(const const_iterator& outro) const { return node != outro.node; }
+
+   private:
+    /**
+     * @brief Nó atual (`nullptr` representa o fim)
+     *
+     */
+    const Node* node;
+
+    /**
+     * @brief Árvore percorrida, usada para voltar do fim para o maior valor
+     *
+     */
+    const BinSearchTree<Type, Allocator>* arvore;
+
+    const_iterator(const Node* node, const BinSearchTree<Type, Allocator>* arvore)
+        : node(node), arvore(arvore) {}
+
+    friend class BinSearchTree<Type, Allocator>;
+  };
+
+  using iterator = const_iterator;
+
+  /**
+   * @brief Valores de um intervalo, para serem percorridos com `for (const Type& valor : ...)`
+   *
+   */
+  class Intervalo {
+   public:
+    Intervalo(const_iterator inicio, const_iterator fim) : inicio(inicio), fim(fim) {}
+
+    const_iterator begin() const { return inicio; }
+    const_iterator end() const { return fim; }
+
+   private:
+    const_iterator inicio;
+    const_iterator fim;
+  };
+
+  BinSearchTree() : BinSearchTree(Allocator()) {}
+  explicit BinSearchTree(const Allocator& alocador)
+      : raiz(nullptr), blocos(nullptr), livres(nullptr), desbalanceados(0), alocador(alocador) {}
+  BinSearchTree(const BinSearchTree<Type, Allocator>& outraArvore);
+
+  /**
+   * @brief Construtor cópia paralelo: copia subárvores diferentes em threads diferentes
+   *
+   * O resultado é idêntico ao do construtor cópia. Como o tamanho de cada subárvore é conhecido,
+   * cada tarefa sabe de antemão em que posições do bloco da cópia os seus nós devem ficar.
+   */
+  BinSearchTree(const BinSearchTree<Type, Allocator>& outraArvore, WorkStealingPool& pool);
+
+  BinSearchTree<Type, Allocator>& operator=(const BinSearchTree<Type, Allocator>&) = delete;
   ~BinSearchTree();
 
   /**
    * @brief Insere um valor na árvore binária de busca.
    *
-   * O valor é inserido de maneira recursiva na árvore. Caso o valor seja menor que o valor do nó
-   * atual, ele é adicionado à subárvore esquerda. Caso contrário, ele é adicionado à subárvore
+   * O valor é inserido descendo a árvore a partir da raiz. Caso o valor seja menor que o valor do
+   * nó atual, ele é adicionado à subárvore esquerda. Caso contrário, ele é adicionado à subárvore
    * direita.
    *
    * @param valor O valor a ser inserido na árvore.
    */
   void insert(Type valor);
 
+  /**
+   * @brief Substitui o conteúdo da árvore por uma árvore perfeitamente balanceada com os valores
+   * (já ordenados) de `[primeiro, ultimo)`.
+   *
+   * O valor do meio de cada intervalo vira a raiz da subárvore correspondente. Os nós são criados
+   * em O(n), em uma única alocação, sem nenhuma comparação além da verificação da ordem.
+   *
+   * @throw `std::invalid_argument` se os valores não estiverem ordenados
+   */
+  template <typename Iterador>
+  void buildFromSorted(Iterador primeiro, Iterador ultimo);
+
+  /**
+   * @brief Remove todos os valores da árvore
+   *
+   */
+  void clear();
+
+  /**
+   * @brief Remove todos os valores da árvore, destruindo subárvores diferentes em paralelo
+   *
+   * Se `Type` tiver destrutor trivial não há nada a paralelizar: só os blocos são liberados.
+   */
+  void clear(WorkStealingPool& pool);
+
+  /**
+   * @brief Chama `funcao` para cada valor da árvore, em paralelo
+   *
+   * A árvore é dividida em subárvores de até `GRAO_PARALELO` nós, processadas por tarefas do
+   * `pool`. A ordem das chamadas não é definida e `funcao` é chamada por várias threads ao mesmo
+   * tempo.
+   *
+   * @param funcao Recebe `const Type&`
+   */
+  template <typename Funcao>
+  void for_each(Funcao funcao, WorkStealingPool& pool) const;
+
+  /**
+   * @brief Combina todos os valores da árvore com `combinar`, em paralelo
+   *
+   * Cada subárvore é reduzida por uma tarefa e os resultados parciais são combinados depois, em
+   * uma ordem não definida; por isso `combinar` deve ser associativa e comutativa (como em
+   * `std::reduce`).
+   *
+   * @param inicial Valor combinado com o resultado (retornado se a árvore estiver vazia)
+   * @param combinar Recebe dois `Type` e retorna um `Type`
+   * @return Type
+   */
+  template <typename Combinar>
+  Type reduce(Type inicial, Combinar combinar, WorkStealingPool& pool) const;
+
   /**
    * @brief Percorre a árvore em pré-ordem (pre-order) e imprime os valores.
    *
@@ -71,9 +317,76 @@ class BinSearchTree {
    */
   bool search(Type valor) const;
 
+  /**
+   * @brief Verifica, para cada valor de `valores`, se ele está presente na árvore.
+   *
+   * Em uma árvore grande, cada passo de uma busca costuma ser uma falta de cache, e buscas feitas
+   * uma depois da outra esperam essas faltas em sequência. Aqui várias buscas avançam intercaladas:
+   * cada uma desce um nível, pede (prefetch) o próximo nó e dá a vez para a seguinte, de modo que
+   * as faltas de cache das buscas do grupo se sobrepõem. Quando uma busca termina, o próximo valor
+   * ocupa o seu lugar.
+   *
+   * @param valores Valores a serem buscados
+   * @param resultados Recebe, na mesma ordem, se cada valor foi encontrado
+   */
+  void search_batch(const std::vector<Type>& valores, std::vector<bool>& resultados) const;
+
+  /**
+   * @brief Retorna um iterador para o menor valor da árvore
+   *
+   */
+  const_iterator begin() const;
+
+  /**
+   * @brief Retorna o iterador que indica o fim da árvore (depois do maior valor)
+   *
+   */
+  const_iterator end() const;
+
+  /**
+   * @brief Retorna um iterador para o primeiro valor maior ou igual a `valor`
+   *
+   * Custa O(altura), o mesmo que uma busca.
+   *
+   * @return const_iterator `end()` se todos os valores forem menores
+   */
+  const_iterator lower_bound(const Type& valor) const;
+
+  /**
+   * @brief Retorna um iterador para o primeiro valor estritamente maior que `valor`
+   *
+   * Custa O(altura), o mesmo que uma busca.
+   *
+   * @return const_iterator `end()` se nenhum valor for maior
+   */
+  const_iterator upper_bound(const Type& valor) const;
+
+  /**
+   * @brief Retorna os valores em `[menor, maior]`, em ordem crescente
+   *
+   * Obter o intervalo custa O(altura) e percorrê-lo custa O(k) para k valores (cada passo do
+   * iterador é O(1) amortizado).
+   *
+   * @return Intervalo Pode ser usado diretamente em um `for` de intervalo
+   */
+  Intervalo range(const Type& menor, const Type& maior) const;
+
+  /**
+   * @brief Remove uma ocorrência de um valor da árvore.
+   *
+   * Se o nó removido tiver dois filhos, ele recebe o valor do seu sucessor (o menor valor da
+   * subárvore direita) e o nó do sucessor é removido no lugar dele.
+   *
+   * @param valor O valor a ser removido
+   * @return true se o valor estava na árvore
+   */
+  bool remove(Type valor);
+
   /**
    * @brief Retorna a altura da árvore
    *
+   * A altura de cada subárvore é mantida nos nós, então a consulta é O(1).
+   *
    * @return size_t
    */
   size_t height() const;
@@ -81,272 +394,1094 @@ class BinSearchTree {
   /**
    * @brief Retorna a quantidade de nós da árvore
    *
+   * O tamanho de cada subárvore é mantido nos nós, então a consulta é O(1).
+   *
    * @return size_t
    */
   size_t countNodes() const;
 
+  /**
+   * @brief Retorna quantos bytes os nós da árvore ocupam
+   *
+   * Não inclui o espaço desperdiçado pelo alocador em cada alocação.
+   *
+   * @return size_t
+   */
+  size_t memoryUsage() const;
+
+  /**
+   * @brief Retorna uma cópia do alocador da árvore
+   *
+   * @return Allocator
+   */
+  Allocator get_allocator() const;
+
   /**
    * @brief Retorna se a árvore está ou não balanceada
+   *
+   * Uma árvore está balanceada se, em todos os nós, as alturas das subárvores esquerda e direita
+   * diferem em no máximo 1. A consulta é O(1): a árvore mantém a contagem de nós que violam essa
+   * condição.
    */
   bool isBalanced() const;
 
- private:
   /**
-   * @brief Função auxiliar utilizada pelo Construtor cópia.
+   * @brief Retorna quantos valores da árvore são estritamente menores que `valor`
    *
-   * Essa função é utilizada para copiar recursivamente os valores dos nós de uma árvore binária
+   * Custa O(altura): a cada passo para a direita são somados os nós da subárvore esquerda.
    *
-   * @param arvore Árvore destino da cópia
-   * @param node Nó atual da árvore que está sendo copiada
+   * @param valor
+   * @return size_t
    */
-  void auxCopia(BinSearchTree<Type>& arvore, const Node* node);
+  size_t rank(Type valor) const;
 
   /**
-   * @brief Função auxiliar utilizada pelo Destrutor.
+   * @brief Retorna o k-ésimo menor valor da árvore (k começando em 0)
+   *
+   * Custa O(altura), o mesmo que uma busca.
    *
-   * Essa função é utilizada para destruir recursivamente os valores dos nós de uma árvore binária
+   * @param k Posição do valor na ordem crescente
+   * @return Type
    *
-   * @param node Nó atual da árvore que está sendo destruida
+   * @throw `std::out_of_range` se `k` for maior ou igual à quantidade de nós
    */
-  void auxDestrutor(Node* node);
+  Type select(size_t k) const;
+
+  /**
+   * @brief Retorna o valor no percentil `p` (por exemplo, 0.99 para o p99)
+   *
+   * É o valor de posição `floor(p * (n - 1))` na ordem crescente, obtido com `select`.
+   *
+   * @param p Percentil entre 0 e 1
+   * @return Type
+   *
+   * @throw `std::out_of_range` se a árvore estiver vazia ou `p` estiver fora de [0, 1]
+   */
+  Type percentile(double p) const;
 
   /**
-   * @brief Insere um valor em um nó da árvore de forma recursiva.
+   * @brief Retorna uma cópia imutável da árvore, otimizada para buscas
    *
-   * Esse método compara o valor a ser inserido com o valor do nó atual e decide se o valor deve ser
-   * inserido na subárvore esquerda ou direita.
+   * Os valores são percorridos em ordem e gravados em um vetor na ordem de Eytzinger, sem
+   * ponteiros (veja `EytzingerTree`). Alterações posteriores nesta árvore não afetam a cópia.
    *
-   * @param node O nó atual da árvore onde a inserção será realizada.
-   * @param valor O valor a ser inserido no nó.
-   * @return Retorna o nó atual, que pode ter sido modificado durante a inserção.
+   * @return EytzingerTree<Type>
    */
-  Node* insert(Node* node, Type valor);
+  EytzingerTree<Type> freeze() const;
 
+ private:
   /**
-   * @brief Realiza um percurso recursivo pré-ordem na árvore e imprime os valores.
+   * @brief Função auxiliar utilizada pelo Construtor cópia.
    *
-   * Esse método visita o nó raiz, a subárvore esquerda, e a subárvore direita, imprimindo os
-   * valores no caminho.
+   * Essa função percorre a subárvore original em pré-ordem (com uma pilha explícita) e copia cada
+   * nó, com seus metadados, para posições consecutivas a partir de `posicao`. Nenhuma comparação ou
+   * rebalanceamento é feito, então a cópia custa O(n) seja qual for o formato da árvore.
    *
-   * @param node O nó atual da árvore que está sendo percorrido.
+   * @param node Raiz da subárvore que está sendo copiada
+   * @param pai Pai da cópia
+   * @param destino Ponteiro que deve receber a cópia
+   * @param posicao Início das `node->tamanho` posições reservadas para a cópia
    */
-  void preOrder(Node* node) const;
+  static void auxCopia(const Node* node, Node* pai, Node** destino, Node* posicao);
 
   /**
-   * @brief Realiza um percurso recursivo em ordem na árvore e imprime os valores.
+   * @brief Versão paralela de `auxCopia`
    *
-   * Esse método visita a subárvore esquerda, o nó raiz e a subárvore direita, imprimindo os valores
-   * no caminho.
+   * Desce pela maior subárvore de cada nó; a menor, se passar de `GRAO_PARALELO` nós, vira uma nova
+   * tarefa do grupo. Em pré-ordem a subárvore esquerda ocupa as posições logo depois do nó e a
+   * direita vem em seguida, então as tarefas escrevem em faixas disjuntas do bloco.
+   */
+  static void auxCopiaParalela(const Node* node, Node* pai, Node** destino, Node* posicao,
+                               WorkStealingPool::Grupo& grupo);
+
+  /**
+   * @brief Destrói os valores da subárvore em paralelo (a memória é liberada com os blocos)
    *
-   * @param node O nó atual da árvore que está sendo percorrido.
    */
-  void inOrder(Node* node) const;
+  void destruirParalelo(Node* node, WorkStealingPool::Grupo& grupo);
+
+  template <typename Funcao>
+  static void visitar(const Node* node, Funcao& funcao);
+
+  template <typename Funcao>
+  static void visitarParalelo(const Node* node, Funcao& funcao, WorkStealingPool::Grupo& grupo);
+
+  template <typename Combinar>
+  static Type reduzir(const Node* node, Combinar& combinar);
 
   /**
-   * @brief Realiza um percurso recursivo em ordem na árvore e imprime os valores.
+   * @brief Reduz a subárvore (que não pode ser vazia) em paralelo
    *
-   * Esse método visita a subárvore esquerda, a subárvore direita e o nó raiz, imprimindo os valores
-   * no caminho.
+   * Cada chamada usa o seu próprio grupo, pois precisa dos resultados das tarefas que criou.
+   */
+  template <typename Combinar>
+  static Type reduzirParalelo(const Node* node, Combinar& combinar, WorkStealingPool& pool);
+
+  /**
+   * @brief Função auxiliar utilizada pelo Destrutor.
+   *
+   * Essa função destrói os nós sem recursão e sem memória extra: enquanto o nó atual tiver filho
+   * esquerdo, é feita uma rotação à direita; quando não tiver, o nó é destruído e o percurso segue
+   * pela direita. A memória dos nós é devolvida depois, junto com os blocos.
    *
-   * @param node O nó atual da árvore que está sendo percorrido.
+   * @param node Raiz da árvore que está sendo destruida
    */
-  void postOrder(Node* node) const;
+  void auxDestrutor(Node* node);
 
   /**
-   * @brief Verifica se um valor específico está presente na árvore.
+   * @brief Destrói todos os nós e devolve os blocos, deixando a árvore vazia
    *
-   * Esse método utiliza a lógica de implementação da árvore binária de busca para uma performance
-   * mais eficiente.
+   * Se `Type` tiver destrutor trivial, os nós não precisam ser visitados e só os blocos são
+   * liberados.
+   */
+  void liberarArvore();
+
+  /**
+   * @brief Constrói um nó em uma posição livre (reaproveitada ou do bloco atual)
    *
-   * @param node Nó atual que está sendo verificado para busca.
-   * @param valor Valor que está sendo buscado.
    */
-  bool search(Node* node, Type valor) const;
+  Node* criarNo(const Type& valor);
 
-  // TODO: remoção(remove)
+  /**
+   * @brief Destrói o nó e guarda sua posição para o próximo `criarNo`
+   *
+   */
+  void liberarNo(Node* node);
 
   /**
-   * @brief Retorna a altura da árvore
+   * @brief Aloca um bloco exclusivo com `quantidade` posições (não inicializadas) de nós
    *
-   * Esse método retorna 1 + a maior altura entre as subárvores à esquerda e à direita.
+   * @return Node* Primeira posição do bloco
+   */
+  Node* reservarNos(size_t quantidade);
+
+  /**
+   * @brief Aloca (pelo alocador da árvore) um bloco com espaço para `capacidade` nós
    *
-   * @param node
-   * @return size_t
    */
-  size_t height(Node* node) const;
+  Bloco* alocarBloco(size_t capacidade);
+  void liberarBloco(Bloco* bloco);
 
   /**
-   * @brief Retorna a quantidade de nós da árvore
+   * @brief Quantidade de `Bloco` (cabeçalho incluído) que cobre `capacidade` nós
    *
-   * Esse método retorna 1 + a contagem de nós das subárvores à esquerda e à direita.
+   */
+  static size_t unidades(size_t capacidade);
+
+  static size_t tamanho(const Node* node);
+
+  /**
+   * @brief Retorna o nó com o menor valor da subárvore
    *
-   * @param node Nó atual que está sendo contado
-   * @return size_t
    */
-  size_t countNodes(Node* node) const;
+  static const Node* minimo(const Node* node);
 
   /**
-   * @brief Retorna se a árvore está ou não balanceada
+   * @brief Retorna o nó com o maior valor da subárvore
+   *
+   */
+  static const Node* maximo(const Node* node);
+  static size_t altura(const Node* node);
+
+  /**
+   * @brief Recalcula a altura e a marcação de desbalanceamento de um nó a partir dos filhos
+   *
+   * @param node Nó cujos filhos podem ter mudado de altura
+   * @return true se a altura do nó mudou (e portanto os ancestrais também precisam ser revistos)
+   */
+  bool atualizarMetadados(Node* node);
+
+  /**
+   * @brief Recalcula os metadados dos nós do caminho, do fim para o início
+   *
+   * Para assim que um nó mantém a mesma altura, pois acima dele nada mudou.
    *
-   * @param node Nó atual
+   * @param caminho Nós da raiz até o ponto da alteração
    */
-  bool isBalanced(Node* node) const;
+  void atualizarCaminho(PilhaContigua<Node*, 64>& caminho);
 };
 
-template <typename Type>
-BinSearchTree<Type>::BinSearchTree(const BinSearchTree<Type>& outraArvore) : BinSearchTree() {
-  if (outraArvore.raiz != nullptr) {
-    insert(outraArvore.raiz->valor);
+template <typename Type, typename Allocator>
+BinSearchTree<Type, Allocator>::BinSearchTree(const BinSearchTree<Type, Allocator>& outraArvore)
+    : BinSearchTree(std::allocator_traits<Allocator>::select_on_container_copy_construction(
+          outraArvore.get_allocator())) {
+  if (outraArvore.raiz == nullptr) return;
+
+  auxCopia(outraArvore.raiz, nullptr, &raiz, reservarNos(outraArvore.raiz->tamanho));
+  desbalanceados = outraArvore.desbalanceados;
+}
+
+template <typename Type, typename Allocator>
+BinSearchTree<Type, Allocator>::BinSearchTree(const BinSearchTree<Type, Allocator>& outraArvore,
+                                              WorkStealingPool& pool)
+    : BinSearchTree(std::allocator_traits<Allocator>::select_on_container_copy_construction(
+          outraArvore.get_allocator())) {
+  if (outraArvore.raiz == nullptr) return;
+
+  Node* nos = reservarNos(outraArvore.raiz->tamanho);
+  WorkStealingPool::Grupo grupo(pool);
+  auxCopiaParalela(outraArvore.raiz, nullptr, &raiz, nos, grupo);
+  grupo.aguardar();
 
-    // Copia recursivamente os demais nós (subárvores esquerda e direita)
-    auxCopia(*this, outraArvore.raiz->left);
-    auxCopia(*this, outraArvore.raiz->right);
+  desbalanceados = outraArvore.desbalanceados;
+}
+
+template <typename Type, typename Allocator>
+void BinSearchTree<Type, Allocator>::auxCopia(
+    const typename BinSearchTree<Type, Allocator>::Node* node,
+    typename BinSearchTree<Type, Allocator>::Node* pai,
+    typename BinSearchTree<Type, Allocator>::Node** destino,
+    typename BinSearchTree<Type, Allocator>::Node* posicao) {
+  size_t criados = 0;
+
+  // Cada item da pilha é um nó original, o pai da sua cópia e o ponteiro que deve recebê-la
+  struct Pendente {
+    const Node* original;
+    Node* pai;
+    Node** destino;
+  };
+  PilhaContigua<Pendente, 64> pilha;
+  pilha.push(Pendente{node, pai, destino});
+
+  // Pré-ordem: o filho esquerdo fica logo depois do pai no bloco
+  while (!pilha.isEmpty()) {
+    Pendente pendente = pilha.top();
+    pilha.pop();
+
+    const Node* original = pendente.original;
+    Node* copia = new (posicao + criados) Node(original->valor);
+    ++criados;
+    copia->pai = pendente.pai;
+    copia->tamanho = original->tamanho;
+    copia->altura = original->altura;
+    copia->desbalanceado = original->desbalanceado;
+    *pendente.destino = copia;
+
+    if (original->right != nullptr) pilha.push(Pendente{original->right, copia, &copia->right});
+    if (original->left != nullptr) pilha.push(Pendente{original->left, copia, &copia->left});
   }
 }
 
-template <typename Type>
-void BinSearchTree<Type>::auxCopia(BinSearchTree<Type>& arvore,
-                                   const typename BinSearchTree<Type>::Node* node) {
-  if (node != nullptr) {
-    arvore.insert(node->valor);
-    auxCopia(arvore, node->left);
-    auxCopia(arvore, node->right);
+template <typename Type, typename Allocator>
+template <typename Iterador>
+void BinSearchTree<Type, Allocator>::buildFromSorted(Iterador primeiro, Iterador ultimo) {
+  std::vector<Type> ordenados(primeiro, ultimo);
+  for (size_t i = 1; i < ordenados.size(); ++i) {
+    if (ordenados[i] < ordenados[i - 1]) {
+      throw std::invalid_argument("Os valores devem estar ordenados");
+    }
   }
+
+  liberarArvore();
+  if (ordenados.empty()) return;
+
+  Node* nos = reservarNos(ordenados.size());
+  size_t criados = 0;
+
+  // Cada item da pilha é um intervalo [inicio, fim), o pai da sua raiz e o ponteiro que deve
+  // receber a raiz
+  struct Faixa {
+    size_t inicio;
+    size_t fim;
+    Node* pai;
+    Node** destino;
+  };
+  PilhaContigua<Faixa, 64> pilha;
+  pilha.push(Faixa{0, ordenados.size(), nullptr, &raiz});
+
+  while (!pilha.isEmpty()) {
+    Faixa intervalo = pilha.top();
+    pilha.pop();
+
+    size_t meio = intervalo.inicio + (intervalo.fim - intervalo.inicio) / 2;
+    Node* node = new (nos + criados) Node(std::move(ordenados[meio]));
+    ++criados;
+    node->pai = intervalo.pai;
+    *intervalo.destino = node;
+
+    // As metades diferem em no máximo um nó, então a altura é a de uma árvore completa
+    node->tamanho = intervalo.fim - intervalo.inicio;
+    node->altura = 0;
+    for (size_t restante = node->tamanho; restante > 0; restante /= 2) ++node->altura;
+
+    if (meio + 1 < intervalo.fim) {
+      pilha.push(Faixa{meio + 1, intervalo.fim, node, &node->right});
+    }
+    if (intervalo.inicio < meio) {
+      pilha.push(Faixa{intervalo.inicio, meio, node, &node->left});
+    }
+  }
+}
+
+template <typename Type, typename Allocator>
+void BinSearchTree<Type, Allocator>::auxCopiaParalela(
+    const typename BinSearchTree<Type, Allocator>::Node* node,
+    typename BinSearchTree<Type, Allocator>::Node* pai,
+    typename BinSearchTree<Type, Allocator>::Node** destino,
+    typename BinSearchTree<Type, Allocator>::Node* posicao, WorkStealingPool::Grupo& grupo) {
+  while (node->tamanho > GRAO_PARALELO) {
+    Node* copia = new (posicao) Node(node->valor);
+    copia->pai = pai;
+    copia->tamanho = node->tamanho;
+    copia->altura = node->altura;
+    copia->desbalanceado = node->desbalanceado;
+    *destino = copia;
+
+    Node* posicaoEsquerda = posicao + 1;
+    Node* posicaoDireita = posicao + 1 + tamanho(node->left);
+
+    // A menor subárvore é copiada à parte e o laço continua pela maior, então a profundidade da
+    // recursão não passa de log2(n) mesmo em uma árvore degenerada
+    bool esquerdaMenor = tamanho(node->left) < tamanho(node->right);
+    const Node* menor = esquerdaMenor ? node->left : node->right;
+    Node** destinoMenor = esquerdaMenor ? &copia->left : &copia->right;
+    Node* posicaoMenor = esquerdaMenor ? posicaoEsquerda : posicaoDireita;
+
+    if (menor != nullptr && menor->tamanho > GRAO_PARALELO) {
+      grupo.executar([menor, copia, destinoMenor, posicaoMenor, &grupo] {
+        auxCopiaParalela(menor, copia, destinoMenor, posicaoMenor, grupo);
+      });
+    } else if (menor != nullptr) {
+      auxCopia(menor, copia, destinoMenor, posicaoMenor);
+    }
+
+    node = esquerdaMenor ? node->right : node->left;
+    pai = copia;
+    destino = esquerdaMenor ? &copia->right : &copia->left;
+    posicao = esquerdaMenor ? posicaoDireita : posicaoEsquerda;
+  }
+
+  if (node != nullptr) auxCopia(node, pai, destino, posicao);
+}
+
+template <typename Type, typename Allocator>
+BinSearchTree<Type, Allocator>::~BinSearchTree() {
+  liberarArvore();
 }
 
-template <typename Type>
-BinSearchTree<Type>::~BinSearchTree() {
-  auxDestrutor(raiz);
+template <typename Type, typename Allocator>
+void BinSearchTree<Type, Allocator>::clear() {
+  liberarArvore();
 }
 
-template <typename Type>
-void BinSearchTree<Type>::auxDestrutor(typename BinSearchTree<Type>::Node* node) {
-  if (node != nullptr) {
-    auxDestrutor(node->left);
-    auxDestrutor(node->right);
+template <typename Type, typename Allocator>
+void BinSearchTree<Type, Allocator>::clear(WorkStealingPool& pool) {
+  if (!std::is_trivially_destructible<Type>::value && raiz != nullptr) {
+    WorkStealingPool::Grupo grupo(pool);
+    destruirParalelo(raiz, grupo);
+    grupo.aguardar();
+
+    // Os valores já foram destruídos; falta só devolver os blocos
+    raiz = nullptr;
   }
 
-  delete node;
+  liberarArvore();
 }
 
-template <typename Type>
-void BinSearchTree<Type>::insert(Type valor) {
-  raiz = insert(raiz, valor);
+template <typename Type, typename Allocator>
+void BinSearchTree<Type, Allocator>::destruirParalelo(
+    typename BinSearchTree<Type, Allocator>::Node* node, WorkStealingPool::Grupo& grupo) {
+  while (node != nullptr && node->tamanho > GRAO_PARALELO) {
+    bool esquerdaMenor = tamanho(node->left) < tamanho(node->right);
+    Node* menor = esquerdaMenor ? node->left : node->right;
+    Node* maior = esquerdaMenor ? node->right : node->left;
+
+    if (menor != nullptr && menor->tamanho > GRAO_PARALELO) {
+      grupo.executar([this, menor, &grupo] { destruirParalelo(menor, grupo); });
+    } else {
+      auxDestrutor(menor);
+    }
+
+    node->~Node();
+    node = maior;
+  }
+
+  auxDestrutor(node);
 }
 
-template <typename Type>
-typename BinSearchTree<Type>::Node* BinSearchTree<Type>::insert(
-    typename BinSearchTree<Type>::Node* node, Type valor) {
-  if (node == nullptr) {
-    return new Node(valor);
+template <typename Type, typename Allocator>
+void BinSearchTree<Type, Allocator>::liberarArvore() {
+  if (!std::is_trivially_destructible<Type>::value) {
+    auxDestrutor(raiz);
   }
 
-  if (valor < node->valor) {
-    node->left = insert(node->left, valor);
+  // Um alocador monotônico não devolve nada individualmente: os blocos são liberados junto com a
+  // arena, e a árvore só precisa esquecê-los
+  if (AlocadorMonotonico<Allocator>::value) blocos = nullptr;
+
+  while (blocos != nullptr) {
+    Bloco* anterior = blocos->anterior;
+    liberarBloco(blocos);
+    blocos = anterior;
+  }
+
+  raiz = nullptr;
+  livres = nullptr;
+  desbalanceados = 0;
+}
+
+template <typename Type, typename Allocator>
+typename BinSearchTree<Type, Allocator>::Node* BinSearchTree<Type, Allocator>::reservarNos(
+    size_t quantidade) {
+  Bloco* bloco = alocarBloco(quantidade);
+  bloco->usados = quantidade;
+
+  // O bloco exclusivo entra atrás do bloco atual, que continua recebendo os próximos `insert`
+  if (blocos == nullptr) {
+    bloco->anterior = nullptr;
+    blocos = bloco;
   } else {
-    node->right = insert(node->right, valor);
+    bloco->anterior = blocos->anterior;
+    blocos->anterior = bloco;
   }
 
+  return bloco->nos();
+}
+
+template <typename Type, typename Allocator>
+typename BinSearchTree<Type, Allocator>::Node* BinSearchTree<Type, Allocator>::criarNo(
+    const Type& valor) {
+  if (livres != nullptr) {
+    Node* posicao = livres;
+    Node* proximoLivre = *reinterpret_cast<Node**>(posicao);
+
+    Node* node = new (posicao) Node(valor);
+    livres = proximoLivre;
+    return node;
+  }
+
+  if (blocos == nullptr || blocos->usados == blocos->capacidade) {
+    size_t capacidade = std::min(std::max(tamanho(raiz), CAPACIDADE_MINIMA), CAPACIDADE_MAXIMA);
+
+    Bloco* bloco = alocarBloco(capacidade);
+    bloco->anterior = blocos;
+    bloco->usados = 0;
+    blocos = bloco;
+  }
+
+  Node* node = new (blocos->nos() + blocos->usados) Node(valor);
+  ++blocos->usados;
   return node;
 }
 
-template <typename Type>
-void BinSearchTree<Type>::preOrder() const {
-  preOrder(raiz);
-  std::cout << std::endl;
+template <typename Type, typename Allocator>
+void BinSearchTree<Type, Allocator>::liberarNo(
+    typename BinSearchTree<Type, Allocator>::Node* node) {
+  node->~Node();
+  *reinterpret_cast<Node**>(node) = livres;
+  livres = node;
 }
 
-template <typename Type>
-void BinSearchTree<Type>::preOrder(typename BinSearchTree<Type>::Node* node) const {
-  if (node == nullptr) return;
+template <typename Type, typename Allocator>
+size_t BinSearchTree<Type, Allocator>::unidades(size_t capacidade) {
+  return 1 + (capacidade * sizeof(Node) + sizeof(Bloco) - 1) / sizeof(Bloco);
+}
+
+template <typename Type, typename Allocator>
+typename BinSearchTree<Type, Allocator>::Bloco* BinSearchTree<Type, Allocator>::alocarBloco(
+    size_t capacidade) {
+  Bloco* bloco = TraitsBloco::allocate(alocador, unidades(capacidade));
+  bloco->capacidade = capacidade;
+  return bloco;
+}
 
-  std::cout << node->valor << " ";
-  preOrder(node->left);
-  preOrder(node->right);
+template <typename Type, typename Allocator>
+void BinSearchTree<Type, Allocator>::liberarBloco(
+    typename BinSearchTree<Type, Allocator>::Bloco* bloco) {
+  TraitsBloco::deallocate(alocador, bloco, unidades(bloco->capacidade));
 }
 
-template <typename Type>
-void BinSearchTree<Type>::inOrder() const {
-  inOrder(raiz);
+template <typename Type, typename Allocator>
+void BinSearchTree<Type, Allocator>::auxDestrutor(
+    typename BinSearchTree<Type, Allocator>::Node* node) {
+  while (node != nullptr) {
+    if (node->left != nullptr) {
+      // Rotação à direita: o filho esquerdo sobe e o nó atual passa a ser seu filho direito
+      Node* esquerdo = node->left;
+      node->left = esquerdo->right;
+      esquerdo->right = node;
+      node = esquerdo;
+    } else {
+      Node* direito = node->right;
+      node->~Node();
+      node = direito;
+    }
+  }
+}
+
+template <typename Type, typename Allocator>
+size_t BinSearchTree<Type, Allocator>::tamanho(
+    const typename BinSearchTree<Type, Allocator>::Node* node) {
+  return node == nullptr ? 0 : node->tamanho;
+}
+
+template <typename Type, typename Allocator>
+const typename BinSearchTree<Type, Allocator>::Node* BinSearchTree<Type, Allocator>::minimo(
+    const typename BinSearchTree<Type, Allocator>::Node* node) {
+  while (node->left != nullptr) node = node->left;
+  return node;
+}
+
+template <typename Type, typename Allocator>
+const typename BinSearchTree<Type, Allocator>::Node* BinSearchTree<Type, Allocator>::maximo(
+    const typename BinSearchTree<Type, Allocator>::Node* node) {
+  while (node->right != nullptr) node = node->right;
+  return node;
+}
+
+template <typename Type, typename Allocator>
+size_t BinSearchTree<Type, Allocator>::altura(
+    const typename BinSearchTree<Type, Allocator>::Node* node) {
+  return node == nullptr ? 0 : node->altura;
+}
+
+template <typename Type, typename Allocator>
+bool BinSearchTree<Type, Allocator>::atualizarMetadados(
+    typename BinSearchTree<Type, Allocator>::Node* node) {
+  size_t alturaEsquerda = altura(node->left);
+  size_t alturaDireita = altura(node->right);
+
+  bool desbalanceado = alturaEsquerda > alturaDireita + 1 || alturaDireita > alturaEsquerda + 1;
+  if (desbalanceado != node->desbalanceado) {
+    node->desbalanceado = desbalanceado;
+    desbalanceados = desbalanceado ? desbalanceados + 1 : desbalanceados - 1;
+  }
+
+  size_t novaAltura = 1 + std::max(alturaEsquerda, alturaDireita);
+  if (novaAltura == node->altura) return false;
+
+  node->altura = novaAltura;
+  return true;
+}
+
+template <typename Type, typename Allocator>
+void BinSearchTree<Type, Allocator>::atualizarCaminho(PilhaContigua<Node*, 64>& caminho) {
+  while (!caminho.isEmpty()) {
+    Node* node = caminho.top();
+    caminho.pop();
+
+    if (!atualizarMetadados(node)) break;
+  }
+}
+
+template <typename Type, typename Allocator>
+void BinSearchTree<Type, Allocator>::insert(Type valor) {
+  Node* novo = criarNo(valor);
+  PilhaContigua<Node*, 64> caminho;
+  Node** destino = &raiz;
+
+  // Todos os nós do caminho ganham um descendente
+  while (*destino != nullptr) {
+    Node* atual = *destino;
+    ++atual->tamanho;
+    caminho.push(atual);
+
+    destino = valor < atual->valor ? &atual->left : &atual->right;
+  }
+
+  novo->pai = caminho.isEmpty() ? nullptr : caminho.top();
+  *destino = novo;
+  atualizarCaminho(caminho);
+}
+
+template <typename Type, typename Allocator>
+void BinSearchTree<Type, Allocator>::preOrder() const {
+  PilhaNos pilha;
+  if (raiz != nullptr) pilha.push(raiz);
+
+  while (!pilha.isEmpty()) {
+    const Node* atual = pilha.top();
+    pilha.pop();
+
+    std::cout << atual->valor << " ";
+
+    // O filho direito é empilhado primeiro para que o esquerdo seja visitado antes
+    if (atual->right != nullptr) pilha.push(atual->right);
+    if (atual->left != nullptr) pilha.push(atual->left);
+  }
+
   std::cout << std::endl;
 }
 
-template <typename Type>
-void BinSearchTree<Type>::inOrder(typename BinSearchTree<Type>::Node* node) const {
-  if (node == nullptr) return;
+template <typename Type, typename Allocator>
+void BinSearchTree<Type, Allocator>::inOrder() const {
+  PilhaNos pilha;
+  const Node* atual = raiz;
+
+  while (atual != nullptr || !pilha.isEmpty()) {
+    // Desce o máximo possível pela esquerda guardando o caminho
+    while (atual != nullptr) {
+      pilha.push(atual);
+      atual = atual->left;
+    }
+
+    atual = pilha.top();
+    pilha.pop();
+
+    std::cout << atual->valor << " ";
+    atual = atual->right;
+  }
 
-  inOrder(node->left);
-  std::cout << node->valor << " ";
-  inOrder(node->right);
+  std::cout << std::endl;
 }
 
-template <typename Type>
-void BinSearchTree<Type>::postOrder() const {
-  postOrder(raiz);
+template <typename Type, typename Allocator>
+void BinSearchTree<Type, Allocator>::postOrder() const {
+  PilhaNos pilha;
+  const Node* atual = raiz;
+  const Node* ultimoVisitado = nullptr;
+
+  while (atual != nullptr || !pilha.isEmpty()) {
+    while (atual != nullptr) {
+      pilha.push(atual);
+      atual = atual->left;
+    }
+
+    const Node* topo = pilha.top();
+
+    // Se existe subárvore direita ainda não visitada, ela é percorrida antes do nó
+    if (topo->right != nullptr && topo->right != ultimoVisitado) {
+      atual = topo->right;
+    } else {
+      std::cout << topo->valor << " ";
+      ultimoVisitado = topo;
+      pilha.pop();
+    }
+  }
+
   std::cout << std::endl;
 }
 
-template <typename Type>
-void BinSearchTree<Type>::postOrder(typename BinSearchTree<Type>::Node* node) const {
-  if (node == nullptr) return;
+template <typename Type, typename Allocator>
+bool BinSearchTree<Type, Allocator>::search(Type valor) const {
+  const Node* atual = raiz;
+
+  while (atual != nullptr) {
+    if (atual->valor == valor) return true;
+
+    atual = valor < atual->valor ? atual->left : atual->right;
+  }
 
-  postOrder(node->left);
-  postOrder(node->right);
-  std::cout << node->valor << " ";
+  return false;
 }
 
-template <typename Type>
-bool BinSearchTree<Type>::search(Type valor) const {
-  return search(raiz, valor);
+template <typename Type, typename Allocator>
+void BinSearchTree<Type, Allocator>::search_batch(const std::vector<Type>& valores,
+                                       std::vector<bool>& resultados) const {
+  resultados.assign(valores.size(), false);
+
+  struct Busca {
+    size_t indice;
+    const Node* atual;
+  };
+  Busca buscas[BUSCAS_SIMULTANEAS];
+  size_t ativas = 0;
+  size_t proximo = 0;
+
+  while (ativas < BUSCAS_SIMULTANEAS && proximo < valores.size()) {
+    buscas[ativas++] = Busca{proximo++, raiz};
+  }
+
+  while (ativas > 0) {
+    for (size_t i = 0; i < ativas;) {
+      Busca& busca = buscas[i];
+      const Type& valor = valores[busca.indice];
+      const Node* atual = busca.atual;
+
+      bool terminou = atual == nullptr;
+      if (!terminou && atual->valor == valor) {
+        resultados[busca.indice] = true;
+        terminou = true;
+      }
+
+      if (!terminou) {
+        // Desce um nível e já pede o próximo nó; ele será lido só na próxima rodada
+        busca.atual = valor < atual->valor ? atual->left : atual->right;
+        __builtin_prefetch(busca.atual);
+        ++i;
+      } else if (proximo < valores.size()) {
+        busca = Busca{proximo++, raiz};
+        ++i;
+      } else {
+        // Não há mais valores: a última busca ativa ocupa esta posição
+        busca = buscas[--ativas];
+      }
+    }
+  }
 }
 
-template <typename Type>
-bool BinSearchTree<Type>::search(typename BinSearchTree<Type>::Node* node, Type valor) const {
-  if (node == nullptr) return false;
+template <typename Type, typename Allocator>
+bool BinSearchTree<Type, Allocator>::remove(Type valor) {
+  PilhaContigua<Node*, 64> caminho;
 
-  if (node->valor == valor) return true;
+  // Ponteiro para o campo (raiz, left ou right) que aponta para o nó atual
+  Node** ligacao = &raiz;
 
-  if (valor < node->valor) {
-    return search(node->left, valor);
-  } else {
-    return search(node->right, valor);
+  // Os nós do caminho perdem um descendente (o tamanho é desfeito se o valor não for encontrado)
+  while (*ligacao != nullptr && !((*ligacao)->valor == valor)) {
+    --(*ligacao)->tamanho;
+    caminho.push(*ligacao);
+    ligacao = valor < (*ligacao)->valor ? &(*ligacao)->left : &(*ligacao)->right;
+  }
+
+  Node* removido = *ligacao;
+  if (removido == nullptr) {
+    while (!caminho.isEmpty()) {
+      ++caminho.top()->tamanho;
+      caminho.pop();
+    }
+    return false;
+  }
+
+  if (removido->left != nullptr && removido->right != nullptr) {
+    // Dois filhos: procura o sucessor, que não possui filho esquerdo
+    --removido->tamanho;
+    caminho.push(removido);
+    Node** ligacaoSucessor = &removido->right;
+    while ((*ligacaoSucessor)->left != nullptr) {
+      --(*ligacaoSucessor)->tamanho;
+      caminho.push(*ligacaoSucessor);
+      ligacaoSucessor = &(*ligacaoSucessor)->left;
+    }
+
+    Node* sucessor = *ligacaoSucessor;
+    removido->valor = sucessor->valor;
+
+    ligacao = ligacaoSucessor;
+    removido = sucessor;
+  }
+
+  // O nó removido tem no máximo um filho, que ocupa o seu lugar
+  Node* filho = removido->left != nullptr ? removido->left : removido->right;
+  if (filho != nullptr) filho->pai = removido->pai;
+  *ligacao = filho;
+  if (removido->desbalanceado) --desbalanceados;
+  liberarNo(removido);
+
+  atualizarCaminho(caminho);
+  return true;
+}
+
+template <typename Type, typename Allocator>
+size_t BinSearchTree<Type, Allocator>::height() const {
+  return altura(raiz);
+}
+
+template <typename Type, typename Allocator>
+size_t BinSearchTree<Type, Allocator>::countNodes() const {
+  return tamanho(raiz);
+}
+
+template <typename Type, typename Allocator>
+size_t BinSearchTree<Type, Allocator>::memoryUsage() const {
+  return countNodes() * sizeof(Node);
+}
+
+template <typename Type, typename Allocator>
+Allocator BinSearchTree<Type, Allocator>::get_allocator() const {
+  return Allocator(alocador);
+}
+
+template <typename Type, typename Allocator>
+bool BinSearchTree<Type, Allocator>::isBalanced() const {
+  return desbalanceados == 0;
+}
+
+template <typename Type, typename Allocator>
+size_t BinSearchTree<Type, Allocator>::rank(Type valor) const {
+  size_t menores = 0;
+  const Node* atual = raiz;
+
+  while (atual != nullptr) {
+    if (atual->valor < valor) {
+      // O nó atual e toda a sua subárvore esquerda são menores que o valor
+      menores += tamanho(atual->left) + 1;
+      atual = atual->right;
+    } else {
+      atual = atual->left;
+    }
+  }
+
+  return menores;
+}
+
+template <typename Type, typename Allocator>
+Type BinSearchTree<Type, Allocator>::select(size_t k) const {
+  if (k >= countNodes()) {
+    throw std::out_of_range("Posicao invalida (maior ou igual a quantidade de nos)");
+  }
+
+  const Node* atual = raiz;
+  while (true) {
+    size_t esquerda = tamanho(atual->left);
+
+    if (k < esquerda) {
+      atual = atual->left;
+    } else if (k == esquerda) {
+      return atual->valor;
+    } else {
+      k -= esquerda + 1;
+      atual = atual->right;
+    }
+  }
+}
+
+template <typename Type, typename Allocator>
+Type BinSearchTree<Type, Allocator>::percentile(double p) const {
+  if (raiz == nullptr) {
+    throw std::out_of_range("A arvore esta vazia");
+  }
+  if (!(p >= 0.0 && p <= 1.0)) {
+    throw std::out_of_range("O percentil deve estar entre 0 e 1");
+  }
+
+  return select(static_cast<size_t>(p * (countNodes() - 1)));
+}
+
+template <typename Type, typename Allocator>
+EytzingerTree<Type> BinSearchTree<Type, Allocator>::freeze() const {
+  // Os iteradores já percorrem os valores em ordem crescente
+  return EytzingerTree<Type>(begin(), end());
+}
+
+template <typename Type, typename Allocator>
+typename BinSearchTree<Type, Allocator>::const_iterator&
+BinSearchTree<Type, Allocator>::const_iterator::operator++() {
+  if (node->right != nullptr) {
+    // O sucessor é o menor valor da subárvore direita
+    node = minimo(node->right);
+    return *this;
+  }
+
+  // Senão, sobe enquanto vier de um filho direito; o sucessor é o primeiro ancestral à direita
+  const Node* filho = node;
+  node = node->pai;
+  while (node != nullptr && filho == node->right) {
+    filho = node;
+    node = node->pai;
+  }
+  return *this;
+}
+
+template <typename Type, typename Allocator>
+typename BinSearchTree<Type, Allocator>::const_iterator
+BinSearchTree<Type, Allocator>::const_iterator::operator++(int) {
+  const_iterator anterior = *this;
+  ++*this;
+  return anterior;
+}
+
+template <typename Type, typename Allocator>
+typename BinSearchTree<Type, Allocator>::const_iterator&
+BinSearchTree<Type, Allocator>::const_iterator::operator--() {
+  if (node == nullptr) {
+    // Voltando do fim: o antecessor é o maior valor da árvore
+    node = maximo(arvore->raiz);
+    return *this;
+  }
+
+  if (node->left != nullptr) {
+    node = maximo(node->left);
+    return *this;
   }
+
+  const Node* filho = node;
+  node = node->pai;
+  while (node != nullptr && filho == node->left) {
+    filho = node;
+    node = node->pai;
+  }
+  return *this;
 }
 
-template <typename Type>
-size_t BinSearchTree<Type>::height() const {
-  return height(raiz);
+template <typename Type, typename Allocator>
+typename BinSearchTree<Type, Allocator>::const_iterator
+BinSearchTree<Type, Allocator>::const_iterator::operator--(int) {
+  const_iterator anterior = *this;
+  --*this;
+  return anterior;
 }
 
-template <typename Type>
-size_t BinSearchTree<Type>::height(typename BinSearchTree<Type>::Node* node) const {
-  if (node == nullptr) return 0;
+template <typename Type, typename Allocator>
+typename BinSearchTree<Type, Allocator>::const_iterator
+BinSearchTree<Type, Allocator>::begin() const {
+  return const_iterator(raiz == nullptr ? nullptr : minimo(raiz), this);
+}
 
-  return 1 + std::max(height(node->left), height(node->right));
+template <typename Type, typename Allocator>
+typename BinSearchTree<Type, Allocator>::const_iterator
+BinSearchTree<Type, Allocator>::end() const {
+  return const_iterator(nullptr, this);
 }
 
-template <typename Type>
-size_t BinSearchTree<Type>::countNodes() const {
-  return countNodes(raiz);
+template <typename Type, typename Allocator>
+typename BinSearchTree<Type, Allocator>::const_iterator BinSearchTree<Type, Allocator>::lower_bound(
+    const Type& valor) const {
+  const Node* resposta = nullptr;
+  const Node* atual = raiz;
+
+  while (atual != nullptr) {
+    if (atual->valor < valor) {
+      atual = atual->right;
+    } else {
+      // Candidato; pode haver um valor maior ou igual menor que ele à esquerda
+      resposta = atual;
+      atual = atual->left;
+    }
+  }
+
+  return const_iterator(resposta, this);
 }
 
-template <typename Type>
-size_t BinSearchTree<Type>::countNodes(typename BinSearchTree<Type>::Node* node) const {
-  if (node == nullptr) return 0;
+template <typename Type, typename Allocator>
+typename BinSearchTree<Type, Allocator>::const_iterator BinSearchTree<Type, Allocator>::upper_bound(
+    const Type& valor) const {
+  const Node* resposta = nullptr;
+  const Node* atual = raiz;
 
-  return 1 + countNodes(node->left) + countNodes(node->right);
+  while (atual != nullptr) {
+    if (valor < atual->valor) {
+      resposta = atual;
+      atual = atual->left;
+    } else {
+      atual = atual->right;
+    }
+  }
+
+  return const_iterator(resposta, this);
+}
+
+template <typename Type, typename Allocator>
+typename BinSearchTree<Type, Allocator>::Intervalo BinSearchTree<Type, Allocator>::range(
+    const Type& menor, const Type& maior) const {
+  if (maior < menor) {
+    return Intervalo(end(), end());
+  }
+
+  return Intervalo(lower_bound(menor), upper_bound(maior));
+}
+
+template <typename Type, typename Allocator>
+template <typename Funcao>
+void BinSearchTree<Type, Allocator>::visitar(
+    const typename BinSearchTree<Type, Allocator>::Node* node, Funcao& funcao) {
+  PilhaNos pilha;
+  if (node != nullptr) pilha.push(node);
+
+  while (!pilha.isEmpty()) {
+    const Node* atual = pilha.top();
+    pilha.pop();
+
+    funcao(atual->valor);
+
+    if (atual->right != nullptr) pilha.push(atual->right);
+    if (atual->left != nullptr) pilha.push(atual->left);
+  }
 }
 
-template <typename Type>
-bool BinSearchTree<Type>::isBalanced() const {
-  return isBalanced(raiz);
+template <typename Type, typename Allocator>
+template <typename Funcao>
+void BinSearchTree<Type, Allocator>::visitarParalelo(
+    const typename BinSearchTree<Type, Allocator>::Node* node, Funcao& funcao,
+    WorkStealingPool::Grupo& grupo) {
+  while (node != nullptr && node->tamanho > GRAO_PARALELO) {
+    bool esquerdaMenor = tamanho(node->left) < tamanho(node->right);
+    const Node* menor = esquerdaMenor ? node->left : node->right;
+
+    if (menor != nullptr && menor->tamanho > GRAO_PARALELO) {
+      grupo.executar([menor, &funcao, &grupo] { visitarParalelo(menor, funcao, grupo); });
+    } else {
+      visitar(menor, funcao);
+    }
+
+    funcao(node->valor);
+    node = esquerdaMenor ? node->right : node->left;
+  }
+
+  visitar(node, funcao);
+}
+
+template <typename Type, typename Allocator>
+template <typename Funcao>
+void BinSearchTree<Type, Allocator>::for_each(Funcao funcao, WorkStealingPool& pool) const {
+  WorkStealingPool::Grupo grupo(pool);
+  visitarParalelo(raiz, funcao, grupo);
+  grupo.aguardar();
+}
+
+template <typename Type, typename Allocator>
+template <typename Combinar>
+Type BinSearchTree<Type, Allocator>::reduzir(
+    const typename BinSearchTree<Type, Allocator>::Node* node, Combinar& combinar) {
+  Type resultado = node->valor;
+
+  PilhaNos pilha;
+  if (node->left != nullptr) pilha.push(node->left);
+  if (node->right != nullptr) pilha.push(node->right);
+
+  while (!pilha.isEmpty()) {
+    const Node* atual = pilha.top();
+    pilha.pop();
+
+    resultado = combinar(resultado, atual->valor);
+
+    if (atual->right != nullptr) pilha.push(atual->right);
+    if (atual->left != nullptr) pilha.push(atual->left);
+  }
+
+  return resultado;
+}
+
+template <typename Type, typename Allocator>
+template <typename Combinar>
+Type BinSearchTree<Type, Allocator>::reduzirParalelo(
+    const typename BinSearchTree<Type, Allocator>::Node* node, Combinar& combinar,
+    WorkStealingPool& pool) {
+  if (node->tamanho <= GRAO_PARALELO) return reduzir(node, combinar);
+
+  WorkStealingPool::Grupo grupo(pool);
+
+  // Os resultados das tarefas; a deque não move os elementos já inseridos
+  std::deque<Type> parciais;
+  Type resultado = node->valor;
+
+  while (true) {
+    bool esquerdaMenor = tamanho(node->left) < tamanho(node->right);
+    const Node* menor = esquerdaMenor ? node->left : node->right;
+    const Node* maior = esquerdaMenor ? node->right : node->left;
+
+    if (menor != nullptr && menor->tamanho > GRAO_PARALELO) {
+      parciais.push_back(menor->valor);
+      Type* parcial = &parciais.back();
+      grupo.executar([menor, parcial, &combinar, &pool] {
+        *parcial = reduzirParalelo(menor, combinar, pool);
+      });
+    } else if (menor != nullptr) {
+      resultado = combinar(resultado, reduzir(menor, combinar));
+    }
+
+    if (maior == nullptr) break;
+    if (maior->tamanho <= GRAO_PARALELO) {
+      resultado = combinar(resultado, reduzir(maior, combinar));
+      break;
+    }
+
+    resultado = combinar(resultado, maior->valor);
+    node = maior;
+  }
+
+  grupo.aguardar();
+  for (const Type& parcial : parciais) resultado = combinar(resultado, parcial);
+  return resultado;
 }
 
-template <typename Type>
-bool BinSearchTree<Type>::isBalanced(typename BinSearchTree<Type>::Node* node) const {
-  if (std::abs(height(node->left) - height(node->right)) > 1) return false;
+template <typename Type, typename Allocator>
+template <typename Combinar>
+Type BinSearchTree<Type, Allocator>::reduce(
+    Type inicial, Combinar combinar, WorkStealingPool& pool) const {
+  if (raiz == nullptr) return inicial;
 
-  return isBalanced(node->left) && isBalanced(node->right);
+  return combinar(inicial, reduzirParalelo(raiz, combinar, pool));
 }
 
 #endif
\ No newline at end of file
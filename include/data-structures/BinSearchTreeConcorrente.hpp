@@ -0,0 +1,643 @@
+#ifndef BINTREE_CONCORRENTE_HPP
+#define BINTREE_CONCORRENTE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <mutex>
+#include <thread>
+
+#include "PilhaContigua.hpp"
+
+/**
+ * @brief Conjunto ordenado baseado na árvore binária de busca, para ser compartilhado entre threads
+ *
+ * A árvore segue o esquema RCU (read-copy-update): os nós publicados nunca são alterados. Um
+ * escritor (`insert`/`remove`) entra em um mutex, copia apenas o caminho da raiz até o ponto
+ * alterado, como a `BinSearchTreePersistente`, e publica a nova raiz com uma escrita atômica.
+ * Leitores (`search`, `inOrder`, `height`) não usam travas: carregam a raiz e descem por uma
+ * versão que não muda durante a leitura. O caminho copiado é balanceado como na `AVLTree`, então
+ * chaves em ordem (timestamps, ids sequenciais) não degradam as operações para O(n).
+ *
+ * Os nós substituídos por uma escrita são desligados da versão nova e "aposentados". Eles são
+ * liberados por reclamação baseada em épocas: cada leitor anuncia a época em que começou, e um nó
+ * aposentado na época E só é liberado quando nenhum leitor ativo anunciou uma época menor ou igual
+ * a E. Assim a memória acompanha a quantidade de valores presentes, mesmo com inserções e remoções
+ * constantes.
+ *
+ * Ao contrário da `BinSearchTree`, valores repetidos não são armazenados (semântica de conjunto).
+ *
+ * @tparam Type
+ */
+template <typename Type>
+class BinSearchTreeConcorrente {
+ private:
+  struct Node {
+    const Type valor;
+    Node* const left;
+    Node* const right;
+
+    /**
+     * @brief Altura da subárvore cuja raiz é este nó (uma folha tem altura 1)
+     *
+     */
+    const int altura;
+
+    /**
+     * @brief Época em que o nó foi criado e, depois de aposentado, época em que foi aposentado
+     *
+     * Só é lida e escrita por escritores (dentro do mutex).
+     */
+    uint64_t epoca;
+
+    /**
+     * @brief Aponta para o próximo nó na lista de substituídos ou na fila de aposentados
+     *
+     */
+    Node* proximoAposentado;
+
+    Node(const Type& valor, Node* left, Node* right, uint64_t epoca)
+        : valor(valor),
+          left(left),
+          right(right),
+          altura(1 + std::max(BinSearchTreeConcorrente::altura(left),
+                              BinSearchTreeConcorrente::altura(right))),
+          epoca(epoca),
+          proximoAposentado(nullptr) {}
+  };
+
+  static constexpr size_t LINHA_CACHE = 64;
+
+  /**
+   * @brief Número máximo de threads que podem estar lendo a árvore ao mesmo tempo
+   *
+   */
+  static constexpr size_t MAX_LEITORES = 128;
+
+  /**
+   * @brief Quantidade de nós aposentados que dispara uma tentativa de liberação
+   *
+   */
+  static constexpr size_t LIMITE_APOSENTADOS = 2 * MAX_LEITORES;
+
+  /**
+   * @brief Valor da época de uma vaga de leitor que não está em uso
+   *
+   */
+  static constexpr uint64_t VAGA_LIVRE = std::numeric_limits<uint64_t>::max();
+
+  /**
+   * @brief Vaga de um leitor: guarda a época anunciada por ele (ou `VAGA_LIVRE`)
+   *
+   */
+  struct alignas(LINHA_CACHE) Leitor {
+    std::atomic<uint64_t> epoca;
+
+    Leitor() : epoca(VAGA_LIVRE) {}
+  };
+
+  /**
+   * @brief Ocupa uma vaga de leitor enquanto existir (RAII)
+   *
+   */
+  class Leitura {
+   public:
+    explicit Leitura(const BinSearchTreeConcorrente<Type>& arvore);
+    Leitura(const Leitura&) = delete;
+    Leitura& operator=(const Leitura&) = delete;
+    ~Leitura();
+
+   private:
+    Leitor* leitor;
+  };
+
+  alignas(LINHA_CACHE) std::atomic<Node*> raiz;
+
+  /**
+   * @brief Época global, incrementada depois de cada publicação de uma nova raiz
+   *
+   */
+  alignas(LINHA_CACHE) std::atomic<uint64_t> epocaGlobal;
+
+  /**
+   * @brief Quantidade de valores presentes
+   *
+   */
+  alignas(LINHA_CACHE) std::atomic<size_t> tamanho;
+
+  /**
+   * @brief Quantidade de nós alocados (presentes ou aposentados e ainda não liberados)
+   *
+   */
+  std::atomic<size_t> nosAlocados;
+
+  /**
+   * @brief Serializa os escritores; os campos abaixo só são usados com ele travado
+   *
+   */
+  alignas(LINHA_CACHE) std::mutex escrita;
+
+  /**
+   * @brief Nós publicados que a escrita em andamento substituiu (aposentados ao publicar)
+   *
+   */
+  Node* substituidos;
+
+  /**
+   * @brief Fila de nós aposentados, em ordem crescente de época
+   *
+   */
+  Node* aposentadosInicio;
+  Node* aposentadosFim;
+  size_t quantidadeAposentados;
+
+  mutable Leitor leitores[MAX_LEITORES];
+
+ public:
+  BinSearchTreeConcorrente();
+  BinSearchTreeConcorrente(const BinSearchTreeConcorrente<Type>&) = delete;
+  BinSearchTreeConcorrente<Type>& operator=(const BinSearchTreeConcorrente<Type>&) = delete;
+  // Destrutor (implementado mais abaixo): não pode haver leitores nem escritores em andamento
+  ~BinSearchTreeConcorrente();
+
+  /**
+   * @brief Insere um valor no conjunto, copiando apenas o caminho até a posição do novo nó.
+   *
+   * Se a cópia de um valor lançar uma exceção, a árvore não é alterada (os nós temporários já
+   * criados são perdidos).
+   *
+   * @param valor O valor a ser inserido
+   * @return false se o valor já estava presente
+   */
+  bool insert(const Type& valor);
+
+  /**
+   * @brief Remove um valor do conjunto, copiando apenas o caminho até ele.
+   *
+   * Os nós substituídos são liberados assim que nenhum leitor puder mais alcançá-los.
+   *
+   * @param valor O valor a ser removido
+   * @return false se o valor não estava presente
+   */
+  bool remove(const Type& valor);
+
+  /**
+   * @brief Verifica se um valor específico está presente no conjunto, sem travas.
+   *
+   * @param valor O valor a ser buscado
+   */
+  bool search(const Type& valor) const;
+
+  /**
+   * @brief Imprime os valores presentes em ordem crescente.
+   *
+   * O percurso usa a versão da árvore existente no início da chamada, então alterações feitas
+   * durante o percurso não aparecem.
+   */
+  void inOrder() const;
+
+  /**
+   * @brief Retorna a altura da versão atual da árvore (O(1), lida da raiz)
+   *
+   * @return size_t
+   */
+  size_t height() const;
+
+  /**
+   * @brief Retorna a quantidade (aproximada, se houver operações em andamento) de valores
+   *
+   * @return size_t
+   */
+  size_t size() const;
+
+  /**
+   * @brief Retorna se o conjunto está (aproximadamente) vazio
+   *
+   */
+  bool isEmpty() const;
+
+  /**
+   * @brief Retorna quantos bytes os nós alocados ocupam
+   *
+   * Inclui os nós aposentados que ainda aguardam leitores antigos terminarem. Não inclui o espaço
+   * desperdiçado pelo alocador em cada alocação.
+   *
+   * @return size_t
+   */
+  size_t memoryUsage() const;
+
+ private:
+  static int altura(const Node* node);
+
+  /**
+   * @brief Cria um nó na época atual (ainda invisível para os leitores)
+   *
+   */
+  Node* criar(const Type& valor, Node* left, Node* right);
+
+  /**
+   * @brief Indica que o nó foi substituído por uma cópia na versão que está sendo construída
+   *
+   * Um nó criado na época atual nunca foi publicado e é liberado na hora; os demais continuam na
+   * versão publicada e só são aposentados quando a nova versão for publicada.
+   */
+  void descartar(Node* node);
+
+  /**
+   * @brief Cria o nó (valor, left, right) aplicando a rotação necessária para balanceá-lo
+   *
+   * Assume que as alturas de `left` e `right` diferem em no máximo 2.
+   *
+   * @return Node* Raiz (nova) da subárvore
+   */
+  Node* balancear(const Type& valor, Node* left, Node* right);
+
+  Node* inserir(Node* node, const Type& valor, bool& inserido);
+  Node* remover(Node* node, const Type& valor, bool& removido);
+
+  /**
+   * @brief Retorna a subárvore sem o seu menor nó
+   *
+   * @param minimo Recebe o nó com o menor valor (ainda não descartado)
+   */
+  Node* removerMinimo(Node* node, Node*& minimo);
+
+  /**
+   * @brief Publica a nova raiz, aposenta os nós substituídos, avança a época e tenta liberar os
+   * nós aposentados
+   *
+   */
+  void publicar(Node* novaRaiz);
+
+  /**
+   * @brief Libera os nós aposentados antes da menor época anunciada pelos leitores ativos
+   *
+   */
+  void liberarAposentados();
+
+  /**
+   * @brief Libera todos os nós de uma subárvore (usado apenas pelo destrutor)
+   *
+   */
+  static void liberarSubarvore(Node* node);
+};
+
+template <typename Type>
+BinSearchTreeConcorrente<Type>::Leitura::Leitura(const BinSearchTreeConcorrente<Type>& arvore) {
+  // Cada thread começa a procura pela última vaga que usou, evitando disputar sempre as primeiras
+  static thread_local size_t dica = 0;
+
+  while (true) {
+    for (size_t i = 0; i < MAX_LEITORES; ++i) {
+      Leitor& candidato = arvore.leitores[(dica + i) % MAX_LEITORES];
+      uint64_t livre = VAGA_LIVRE;
+
+      // Uma época desatualizada só torna o leitor mais conservador
+      uint64_t epoca = arvore.epocaGlobal.load(std::memory_order_seq_cst);
+      if (candidato.epoca.load(std::memory_order_relaxed) == VAGA_LIVRE &&
+          candidato.epoca.compare_exchange_strong(livre, epoca, std::memory_order_seq_cst)) {
+        dica = (dica + i) % MAX_LEITORES;
+        leitor = &candidato;
+        return;
+      }
+    }
+
+    // Mais de MAX_LEITORES threads estão lendo ao mesmo tempo; aguarda uma delas terminar
+    std::this_thread::yield();
+  }
+}
+
+template <typename Type>
+BinSearchTreeConcorrente<Type>::Leitura::~Leitura() {
+  // O release garante que as leituras dos nós terminaram antes de a vaga aparecer livre
+  leitor->epoca.store(VAGA_LIVRE, std::memory_order_release);
+}
+
+template <typename Type>
+BinSearchTreeConcorrente<Type>::BinSearchTreeConcorrente()
+    : raiz(nullptr),
+      epocaGlobal(0),
+      tamanho(0),
+      nosAlocados(0),
+      substituidos(nullptr),
+      aposentadosInicio(nullptr),
+      aposentadosFim(nullptr),
+      quantidadeAposentados(0) {}
+
+template <typename Type>
+BinSearchTreeConcorrente<Type>::~BinSearchTreeConcorrente() {
+  liberarSubarvore(raiz.load(std::memory_order_relaxed));
+
+  while (aposentadosInicio != nullptr) {
+    Node* posterior = aposentadosInicio->proximoAposentado;
+    delete aposentadosInicio;
+    aposentadosInicio = posterior;
+  }
+}
+
+template <typename Type>
+void BinSearchTreeConcorrente<Type>::liberarSubarvore(
+    typename BinSearchTreeConcorrente<Type>::Node* node) {
+  PilhaContigua<Node*, 64> pilha;
+  if (node != nullptr) pilha.push(node);
+
+  while (!pilha.isEmpty()) {
+    node = pilha.top();
+    pilha.pop();
+
+    if (node->left != nullptr) pilha.push(node->left);
+    if (node->right != nullptr) pilha.push(node->right);
+    delete node;
+  }
+}
+
+template <typename Type>
+int BinSearchTreeConcorrente<Type>::altura(
+    const typename BinSearchTreeConcorrente<Type>::Node* node) {
+  return node == nullptr ? 0 : node->altura;
+}
+
+template <typename Type>
+typename BinSearchTreeConcorrente<Type>::Node* BinSearchTreeConcorrente<Type>::criar(
+    const Type& valor, typename BinSearchTreeConcorrente<Type>::Node* left,
+    typename BinSearchTreeConcorrente<Type>::Node* right) {
+  Node* node = new Node(valor, left, right, epocaGlobal.load(std::memory_order_relaxed));
+  nosAlocados.fetch_add(1, std::memory_order_relaxed);
+  return node;
+}
+
+template <typename Type>
+void BinSearchTreeConcorrente<Type>::descartar(
+    typename BinSearchTreeConcorrente<Type>::Node* node) {
+  // Nó temporário desta escrita: nenhum leitor chegou a vê-lo
+  if (node->epoca == epocaGlobal.load(std::memory_order_relaxed)) {
+    delete node;
+    nosAlocados.fetch_sub(1, std::memory_order_relaxed);
+    return;
+  }
+
+  node->proximoAposentado = substituidos;
+  substituidos = node;
+}
+
+template <typename Type>
+typename BinSearchTreeConcorrente<Type>::Node* BinSearchTreeConcorrente<Type>::balancear(
+    const Type& valor, typename BinSearchTreeConcorrente<Type>::Node* left,
+    typename BinSearchTreeConcorrente<Type>::Node* right) {
+  Node* resultado;
+
+  if (altura(left) > altura(right) + 1) {  // Pesado à esquerda
+    if (altura(left->left) >= altura(left->right)) {
+      // Rotação simples à direita: o filho esquerdo sobe
+      resultado = criar(left->valor, left->left, criar(valor, left->right, right));
+    } else {
+      // Caso esquerda-direita: o neto (filho direito do filho esquerdo) sobe
+      Node* neto = left->right;
+      resultado = criar(neto->valor, criar(left->valor, left->left, neto->left),
+                        criar(valor, neto->right, right));
+      descartar(neto);
+    }
+    descartar(left);
+    return resultado;
+  }
+
+  if (altura(right) > altura(left) + 1) {  // Pesado à direita
+    if (altura(right->right) >= altura(right->left)) {
+      resultado = criar(right->valor, criar(valor, left, right->left), right->right);
+    } else {
+      Node* neto = right->left;
+      resultado = criar(neto->valor, criar(valor, left, neto->left),
+                        criar(right->valor, neto->right, right->right));
+      descartar(neto);
+    }
+    descartar(right);
+    return resultado;
+  }
+
+  return criar(valor, left, right);
+}
+
+template <typename Type>
+typename BinSearchTreeConcorrente<Type>::Node* BinSearchTreeConcorrente<Type>::inserir(
+    typename BinSearchTreeConcorrente<Type>::Node* node, const Type& valor, bool& inserido) {
+  if (node == nullptr) {
+    inserido = true;
+    return criar(valor, nullptr, nullptr);
+  }
+
+  Node* resultado;
+  if (valor < node->valor) {
+    Node* esquerdo = inserir(node->left, valor, inserido);
+    if (!inserido) return node;
+    resultado = balancear(node->valor, esquerdo, node->right);
+  } else if (node->valor < valor) {
+    Node* direito = inserir(node->right, valor, inserido);
+    if (!inserido) return node;
+    resultado = balancear(node->valor, node->left, direito);
+  } else {
+    return node;  // O valor já está presente
+  }
+
+  // O nó do caminho foi recriado com o filho alterado; o outro filho é compartilhado
+  descartar(node);
+  return resultado;
+}
+
+template <typename Type>
+typename BinSearchTreeConcorrente<Type>::Node* BinSearchTreeConcorrente<Type>::remover(
+    typename BinSearchTreeConcorrente<Type>::Node* node, const Type& valor, bool& removido) {
+  if (node == nullptr) return nullptr;
+
+  Node* resultado;
+  if (valor < node->valor) {
+    Node* esquerdo = remover(node->left, valor, removido);
+    if (!removido) return node;
+    resultado = balancear(node->valor, esquerdo, node->right);
+  } else if (node->valor < valor) {
+    Node* direito = remover(node->right, valor, removido);
+    if (!removido) return node;
+    resultado = balancear(node->valor, node->left, direito);
+  } else {
+    removido = true;
+
+    if (node->left == nullptr || node->right == nullptr) {
+      // O filho que sobra (se houver) já é uma subárvore válida e é compartilhado
+      resultado = node->left != nullptr ? node->left : node->right;
+    } else {
+      // Dois filhos: o sucessor (menor valor da subárvore direita) ocupa o lugar do valor removido
+      Node* sucessor;
+      Node* direito = removerMinimo(node->right, sucessor);
+      resultado = balancear(sucessor->valor, node->left, direito);
+      descartar(sucessor);
+    }
+  }
+
+  descartar(node);
+  return resultado;
+}
+
+template <typename Type>
+typename BinSearchTreeConcorrente<Type>::Node* BinSearchTreeConcorrente<Type>::removerMinimo(
+    typename BinSearchTreeConcorrente<Type>::Node* node,
+    typename BinSearchTreeConcorrente<Type>::Node*& minimo) {
+  if (node->left == nullptr) {
+    minimo = node;
+    return node->right;
+  }
+
+  Node* resultado = balancear(node->valor, removerMinimo(node->left, minimo), node->right);
+  descartar(node);
+  return resultado;
+}
+
+template <typename Type>
+void BinSearchTreeConcorrente<Type>::publicar(
+    typename BinSearchTreeConcorrente<Type>::Node* novaRaiz) {
+  uint64_t epoca = epocaGlobal.load(std::memory_order_relaxed);
+
+  // Um leitor que anunciar a época nova já carrega a raiz nova
+  raiz.store(novaRaiz, std::memory_order_seq_cst);
+  epocaGlobal.fetch_add(1, std::memory_order_seq_cst);
+
+  // As épocas só crescem, então a fila de aposentados continua ordenada
+  while (substituidos != nullptr) {
+    Node* node = substituidos;
+    substituidos = node->proximoAposentado;
+
+    node->epoca = epoca;
+    node->proximoAposentado = nullptr;
+    if (aposentadosFim != nullptr) {
+      aposentadosFim->proximoAposentado = node;
+    } else {
+      aposentadosInicio = node;
+    }
+    aposentadosFim = node;
+    ++quantidadeAposentados;
+  }
+
+  if (quantidadeAposentados >= LIMITE_APOSENTADOS) {
+    liberarAposentados();
+  }
+}
+
+template <typename Type>
+void BinSearchTreeConcorrente<Type>::liberarAposentados() {
+  // Sem leitores ativos, tudo o que foi aposentado antes da época atual pode ser liberado
+  uint64_t menorEpoca = epocaGlobal.load(std::memory_order_seq_cst);
+  for (const Leitor& leitor : leitores) {
+    menorEpoca = std::min(menorEpoca, leitor.epoca.load(std::memory_order_seq_cst));
+  }
+
+  // Um leitor que anunciou a época E pode ter carregado a raiz substituída na época E
+  size_t liberados = 0;
+  while (aposentadosInicio != nullptr && aposentadosInicio->epoca < menorEpoca) {
+    Node* posterior = aposentadosInicio->proximoAposentado;
+    delete aposentadosInicio;
+    aposentadosInicio = posterior;
+    ++liberados;
+  }
+
+  if (aposentadosInicio == nullptr) aposentadosFim = nullptr;
+  quantidadeAposentados -= liberados;
+  nosAlocados.fetch_sub(liberados, std::memory_order_relaxed);
+}
+
+template <typename Type>
+bool BinSearchTreeConcorrente<Type>::insert(const Type& valor) {
+  std::lock_guard<std::mutex> guarda(escrita);
+
+  bool inserido = false;
+  Node* novaRaiz;
+  try {
+    novaRaiz = inserir(raiz.load(std::memory_order_relaxed), valor, inserido);
+  } catch (...) {
+    substituidos = nullptr;  // Os nós substituídos continuam na versão publicada
+    throw;
+  }
+  if (!inserido) return false;
+
+  tamanho.fetch_add(1, std::memory_order_relaxed);
+  publicar(novaRaiz);
+  return true;
+}
+
+template <typename Type>
+bool BinSearchTreeConcorrente<Type>::remove(const Type& valor) {
+  std::lock_guard<std::mutex> guarda(escrita);
+
+  bool removido = false;
+  Node* novaRaiz;
+  try {
+    novaRaiz = remover(raiz.load(std::memory_order_relaxed), valor, removido);
+  } catch (...) {
+    substituidos = nullptr;  // Os nós substituídos continuam na versão publicada
+    throw;
+  }
+  if (!removido) return false;
+
+  tamanho.fetch_sub(1, std::memory_order_relaxed);
+  publicar(novaRaiz);
+  return true;
+}
+
+template <typename Type>
+bool BinSearchTreeConcorrente<Type>::search(const Type& valor) const {
+  Leitura leitura(*this);
+  const Node* atual = raiz.load(std::memory_order_seq_cst);
+
+  while (atual != nullptr) {
+    if (atual->valor == valor) return true;
+
+    atual = valor < atual->valor ? atual->left : atual->right;
+  }
+
+  return false;
+}
+
+template <typename Type>
+void BinSearchTreeConcorrente<Type>::inOrder() const {
+  Leitura leitura(*this);
+  PilhaContigua<const Node*, 64> pilha;
+  const Node* atual = raiz.load(std::memory_order_seq_cst);
+
+  while (atual != nullptr || !pilha.isEmpty()) {
+    while (atual != nullptr) {
+      pilha.push(atual);
+      atual = atual->left;
+    }
+
+    atual = pilha.top();
+    pilha.pop();
+
+    std::cout << atual->valor << " ";
+    atual = atual->right;
+  }
+
+  std::cout << std::endl;
+}
+
+template <typename Type>
+size_t BinSearchTreeConcorrente<Type>::height() const {
+  Leitura leitura(*this);
+  return static_cast<size_t>(altura(raiz.load(std::memory_order_seq_cst)));
+}
+
+template <typename Type>
+size_t BinSearchTreeConcorrente<Type>::size() const {
+  return tamanho.load(std::memory_order_relaxed);
+}
+
+template <typename Type>
+bool BinSearchTreeConcorrente<Type>::isEmpty() const {
+  return size() == 0;
+}
+
+template <typename Type>
+size_t BinSearchTreeConcorrente<Type>::memoryUsage() const {
+  return nosAlocados.load(std::memory_order_relaxed) * sizeof(Node);
+}
+
+#endif
@@ -0,0 +1,467 @@
+#ifndef BINTREE_PERSISTENTE_HPP
+#define BINTREE_PERSISTENTE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+
+#include "PilhaContigua.hpp"
+
+/**
+ * @brief Árvore binária de busca persistente, com cópias instantâneas (snapshots) em O(1)
+ *
+ * Os nós nunca são alterados depois de criados. `insert` e `remove` criam cópias apenas dos nós do
+ * caminho da raiz até o ponto alterado e reaproveitam todo o resto, então versões antigas continuam
+ * válidas e compartilham com a nova tudo o que não mudou. Cada nó conta quantos pais e versões o
+ * referenciam (contagem atômica), e é liberado quando a última referência desaparece.
+ *
+ * Para que o caminho copiado tenha O(log n) nós, a árvore é balanceada como a `AVLTree` (as
+ * rotações também criam nós novos em vez de alterar os existentes).
+ *
+ * `snapshot()` (e o construtor cópia) só incrementa a contagem da raiz. Uma versão pode ser lida em
+ * uma thread enquanto outra thread altera outra versão; uma mesma versão não deve ser alterada por
+ * duas threads ao mesmo tempo.
+ *
+ * @tparam Type
+ */
+template <typename Type>
+class BinSearchTreePersistente {
+ private:
+  struct Node {
+    const Type valor;
+    const Node* const left;
+    const Node* const right;
+
+    /**
+     * @brief Altura da subárvore cuja raiz é este nó (uma folha tem altura 1)
+     *
+     */
+    const int altura;
+
+    /**
+     * @brief Quantidade de nós da subárvore cuja raiz é este nó
+     *
+     */
+    const size_t tamanho;
+
+    /**
+     * @brief Quantidade de pais e versões que apontam para este nó
+     *
+     */
+    mutable std::atomic<size_t> referencias;
+
+    Node(const Type& valor, const Node* left, const Node* right)
+        : valor(valor),
+          left(left),
+          right(right),
+          altura(1 + std::max(BinSearchTreePersistente::altura(left),
+                              BinSearchTreePersistente::altura(right))),
+          tamanho(1 + BinSearchTreePersistente::tamanho(left) +
+                  BinSearchTreePersistente::tamanho(right)),
+          referencias(0) {}
+  };
+
+  const Node* raiz;
+
+ public:
+  BinSearchTreePersistente() : raiz(nullptr) {}
+  BinSearchTreePersistente(const BinSearchTreePersistente<Type>& outraArvore);
+  BinSearchTreePersistente<Type>& operator=(const BinSearchTreePersistente<Type>&) = delete;
+  ~BinSearchTreePersistente();
+
+  /**
+   * @brief Retorna uma cópia da versão atual da árvore, em O(1)
+   *
+   * A cópia compartilha todos os nós com esta árvore; alterações feitas depois em qualquer uma das
+   * duas não aparecem na outra.
+   *
+   * @return BinSearchTreePersistente<Type>
+   */
+  BinSearchTreePersistente<Type> snapshot() const;
+
+  /**
+   * @brief Insere um valor na árvore, copiando apenas o caminho até a posição do novo nó.
+   *
+   * Valores iguais a um valor existente são adicionados à subárvore direita, como na
+   * `BinSearchTree`.
+   *
+   * @param valor O valor a ser inserido na árvore.
+   */
+  void insert(const Type& valor);
+
+  /**
+   * @brief Remove uma ocorrência de um valor, copiando apenas o caminho até ela.
+   *
+   * @param valor O valor a ser removido
+   * @return true se o valor estava na árvore
+   */
+  bool remove(const Type& valor);
+
+  /**
+   * @brief Verifica se um valor específico está presente na árvore.
+   *
+   * @param valor O valor a ser buscado na árvore
+   */
+  bool search(const Type& valor) const;
+
+  /**
+   * @brief Percorre a árvore em pré-ordem (pre-order) e imprime os valores.
+   *
+   */
+  void preOrder() const;
+
+  /**
+   * @brief Percorre a árvore em ordem (in-order) e imprime os valores.
+   *
+   */
+  void inOrder() const;
+
+  /**
+   * @brief Percorre a árvore em pós-ordem (post-order) e imprime os valores.
+   *
+   */
+  void postOrder() const;
+
+  /**
+   * @brief Retorna a altura da árvore (O(1), lida da raiz)
+   *
+   * @return size_t
+   */
+  size_t height() const;
+
+  /**
+   * @brief Retorna a quantidade de nós da árvore (O(1), lida da raiz)
+   *
+   * @return size_t
+   */
+  size_t countNodes() const;
+
+  /**
+   * @brief Retorna se a árvore está ou não balanceada
+   *
+   * Toda versão é criada já balanceada, então a resposta é obtida em O(1) a partir das alturas
+   * armazenadas nos filhos da raiz.
+   */
+  bool isBalanced() const;
+
+ private:
+  static int altura(const Node* node);
+  static size_t tamanho(const Node* node);
+
+  /**
+   * @brief Acrescenta uma referência ao nó
+   *
+   */
+  static const Node* reter(const Node* node);
+
+  /**
+   * @brief Remove uma referência do nó e libera os nós que ficarem sem referências
+   *
+   * Usa uma pilha explícita, então liberar uma versão inteira não depende da pilha de chamadas.
+   */
+  static void liberar(const Node* node);
+
+  /**
+   * @brief Libera um nó temporário que não chegou a ser referenciado por ninguém
+   *
+   */
+  static void descartar(const Node* node);
+
+  /**
+   * @brief Cria um nó que referencia os filhos indicados
+   *
+   */
+  static const Node* criar(const Type& valor, const Node* left, const Node* right);
+
+  /**
+   * @brief Cria o nó (valor, left, right) aplicando a rotação necessária para balanceá-lo
+   *
+   * Assume que as alturas de `left` e `right` diferem em no máximo 2.
+   *
+   * @return Node* Raiz (nova) da subárvore
+   */
+  static const Node* balancear(const Type& valor, const Node* left, const Node* right);
+
+  static const Node* insert(const Node* node, const Type& valor);
+  static const Node* remove(const Node* node, const Type& valor, bool& removido);
+
+  /**
+   * @brief Retorna a subárvore sem o seu menor nó
+   *
+   * @param minimo Recebe o nó com o menor valor (que continua na versão anterior)
+   */
+  static const Node* removerMinimo(const Node* node, const Node*& minimo);
+
+  /**
+   * @brief Troca a raiz pela nova versão e libera a versão anterior
+   *
+   */
+  void trocarRaiz(const Node* novaRaiz);
+
+  void preOrder(const Node* node) const;
+  void inOrder(const Node* node) const;
+  void postOrder(const Node* node) const;
+};
+
+template <typename Type>
+BinSearchTreePersistente<Type>::BinSearchTreePersistente(
+    const BinSearchTreePersistente<Type>& outraArvore)
+    : raiz(reter(outraArvore.raiz)) {}
+
+template <typename Type>
+BinSearchTreePersistente<Type>::~BinSearchTreePersistente() {
+  liberar(raiz);
+}
+
+template <typename Type>
+BinSearchTreePersistente<Type> BinSearchTreePersistente<Type>::snapshot() const {
+  return BinSearchTreePersistente<Type>(*this);
+}
+
+template <typename Type>
+int BinSearchTreePersistente<Type>::altura(
+    const typename BinSearchTreePersistente<Type>::Node* node) {
+  return node == nullptr ? 0 : node->altura;
+}
+
+template <typename Type>
+size_t BinSearchTreePersistente<Type>::tamanho(
+    const typename BinSearchTreePersistente<Type>::Node* node) {
+  return node == nullptr ? 0 : node->tamanho;
+}
+
+template <typename Type>
+const typename BinSearchTreePersistente<Type>::Node* BinSearchTreePersistente<Type>::reter(
+    const typename BinSearchTreePersistente<Type>::Node* node) {
+  if (node != nullptr) node->referencias.fetch_add(1, std::memory_order_relaxed);
+  return node;
+}
+
+template <typename Type>
+void BinSearchTreePersistente<Type>::liberar(
+    const typename BinSearchTreePersistente<Type>::Node* node) {
+  PilhaContigua<const Node*, 64> pilha;
+  if (node != nullptr) pilha.push(node);
+
+  while (!pilha.isEmpty()) {
+    const Node* atual = pilha.top();
+    pilha.pop();
+
+    // Quem remove a última referência libera o nó e remove a referência dele aos filhos
+    if (atual->referencias.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      if (atual->left != nullptr) pilha.push(atual->left);
+      if (atual->right != nullptr) pilha.push(atual->right);
+      delete atual;
+    }
+  }
+}
+
+template <typename Type>
+void BinSearchTreePersistente<Type>::descartar(
+    const typename BinSearchTreePersistente<Type>::Node* node) {
+  // Nós de versões existentes têm ao menos uma referência; só um nó recém-criado tem zero
+  if (node != nullptr && node->referencias.load(std::memory_order_relaxed) == 0) {
+    liberar(reter(node));
+  }
+}
+
+template <typename Type>
+const typename BinSearchTreePersistente<Type>::Node* BinSearchTreePersistente<Type>::criar(
+    const Type& valor, const typename BinSearchTreePersistente<Type>::Node* left,
+    const typename BinSearchTreePersistente<Type>::Node* right) {
+  const Node* node = new Node(valor, left, right);
+  reter(left);
+  reter(right);
+  return node;
+}
+
+template <typename Type>
+const typename BinSearchTreePersistente<Type>::Node* BinSearchTreePersistente<Type>::balancear(
+    const Type& valor, const typename BinSearchTreePersistente<Type>::Node* left,
+    const typename BinSearchTreePersistente<Type>::Node* right) {
+  const Node* resultado;
+
+  if (altura(left) > altura(right) + 1) {  // Pesado à esquerda
+    if (altura(left->left) >= altura(left->right)) {
+      // Rotação simples à direita: o filho esquerdo sobe
+      resultado = criar(left->valor, left->left, criar(valor, left->right, right));
+    } else {
+      // Caso esquerda-direita: o neto (filho direito do filho esquerdo) sobe
+      const Node* neto = left->right;
+      resultado = criar(neto->valor, criar(left->valor, left->left, neto->left),
+                        criar(valor, neto->right, right));
+    }
+    descartar(left);
+    return resultado;
+  }
+
+  if (altura(right) > altura(left) + 1) {  // Pesado à direita
+    if (altura(right->right) >= altura(right->left)) {
+      resultado = criar(right->valor, criar(valor, left, right->left), right->right);
+    } else {
+      const Node* neto = right->left;
+      resultado = criar(neto->valor, criar(valor, left, neto->left),
+                        criar(right->valor, neto->right, right->right));
+    }
+    descartar(right);
+    return resultado;
+  }
+
+  return criar(valor, left, right);
+}
+
+template <typename Type>
+void BinSearchTreePersistente<Type>::trocarRaiz(
+    const typename BinSearchTreePersistente<Type>::Node* novaRaiz) {
+  reter(novaRaiz);
+  liberar(raiz);
+  raiz = novaRaiz;
+}
+
+template <typename Type>
+void BinSearchTreePersistente<Type>::insert(const Type& valor) {
+  trocarRaiz(insert(raiz, valor));
+}
+
+template <typename Type>
+const typename BinSearchTreePersistente<Type>::Node* BinSearchTreePersistente<Type>::insert(
+    const typename BinSearchTreePersistente<Type>::Node* node, const Type& valor) {
+  if (node == nullptr) {
+    return criar(valor, nullptr, nullptr);
+  }
+
+  // O nó do caminho é recriado com o filho alterado; o outro filho é compartilhado
+  if (valor < node->valor) {
+    return balancear(node->valor, insert(node->left, valor), node->right);
+  }
+  return balancear(node->valor, node->left, insert(node->right, valor));
+}
+
+template <typename Type>
+bool BinSearchTreePersistente<Type>::remove(const Type& valor) {
+  bool removido = false;
+  const Node* novaRaiz = remove(raiz, valor, removido);
+
+  if (removido) trocarRaiz(novaRaiz);
+  return removido;
+}
+
+template <typename Type>
+const typename BinSearchTreePersistente<Type>::Node* BinSearchTreePersistente<Type>::remove(
+    const typename BinSearchTreePersistente<Type>::Node* node, const Type& valor, bool& removido) {
+  if (node == nullptr) return nullptr;
+
+  if (valor < node->valor) {
+    const Node* esquerdo = remove(node->left, valor, removido);
+    return removido ? balancear(node->valor, esquerdo, node->right) : node;
+  }
+
+  if (node->valor < valor) {
+    const Node* direito = remove(node->right, valor, removido);
+    return removido ? balancear(node->valor, node->left, direito) : node;
+  }
+
+  removido = true;
+
+  // O filho que sobra (se houver) já é uma subárvore válida e é compartilhado
+  if (node->left == nullptr) return node->right;
+  if (node->right == nullptr) return node->left;
+
+  // Dois filhos: o sucessor (menor valor da subárvore direita) ocupa o lugar do valor removido
+  const Node* sucessor;
+  const Node* direito = removerMinimo(node->right, sucessor);
+  return balancear(sucessor->valor, node->left, direito);
+}
+
+template <typename Type>
+const typename BinSearchTreePersistente<Type>::Node* BinSearchTreePersistente<Type>::removerMinimo(
+    const typename BinSearchTreePersistente<Type>::Node* node,
+    const typename BinSearchTreePersistente<Type>::Node*& minimo) {
+  if (node->left == nullptr) {
+    minimo = node;
+    return node->right;
+  }
+
+  return balancear(node->valor, removerMinimo(node->left, minimo), node->right);
+}
+
+template <typename Type>
+bool BinSearchTreePersistente<Type>::search(const Type& valor) const {
+  const Node* atual = raiz;
+
+  while (atual != nullptr) {
+    if (atual->valor == valor) return true;
+
+    atual = valor < atual->valor ? atual->left : atual->right;
+  }
+
+  return false;
+}
+
+template <typename Type>
+void BinSearchTreePersistente<Type>::preOrder() const {
+  preOrder(raiz);
+  std::cout << std::endl;
+}
+
+template <typename Type>
+void BinSearchTreePersistente<Type>::preOrder(
+    const typename BinSearchTreePersistente<Type>::Node* node) const {
+  if (node == nullptr) return;
+
+  std::cout << node->valor << " ";
+  preOrder(node->left);
+  preOrder(node->right);
+}
+
+template <typename Type>
+void BinSearchTreePersistente<Type>::inOrder() const {
+  inOrder(raiz);
+  std::cout << std::endl;
+}
+
+template <typename Type>
+void BinSearchTreePersistente<Type>::inOrder(
+    const typename BinSearchTreePersistente<Type>::Node* node) const {
+  if (node == nullptr) return;
+
+  inOrder(node->left);
+  std::cout << node->valor << " ";
+  inOrder(node->right);
+}
+
+template <typename Type>
+void BinSearchTreePersistente<Type>::postOrder() const {
+  postOrder(raiz);
+  std::cout << std::endl;
+}
+
+template <typename Type>
+void BinSearchTreePersistente<Type>::postOrder(
+    const typename BinSearchTreePersistente<Type>::Node* node) const {
+  if (node == nullptr) return;
+
+  postOrder(node->left);
+  postOrder(node->right);
+  std::cout << node->valor << " ";
+}
+
+template <typename Type>
+size_t BinSearchTreePersistente<Type>::height() const {
+  return static_cast<size_t>(altura(raiz));
+}
+
+template <typename Type>
+size_t BinSearchTreePersistente<Type>::countNodes() const {
+  return tamanho(raiz);
+}
+
+template <typename Type>
+bool BinSearchTreePersistente<Type>::isBalanced() const {
+  if (raiz == nullptr) return true;
+
+  int fator = altura(raiz->left) - altura(raiz->right);
+  return fator >= -1 && fator <= 1;
+}
+
+#endif
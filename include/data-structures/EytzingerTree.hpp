@@ -0,0 +1,194 @@
+#ifndef EYTZINGER_TREE_HPP
+#define EYTZINGER_TREE_HPP
+
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief Árvore de busca imutável armazenada em um vetor na ordem de Eytzinger (BFS)
+ *
+ * A raiz fica na posição 1 e os filhos do nó `k` ficam nas posições `2k` e `2k + 1`, então não há
+ * ponteiros: cada valor ocupa só `sizeof(Type)` bytes e os primeiros níveis (os mais acessados)
+ * ficam juntos no início do vetor. A busca desce sem desvios condicionais (o próximo índice é
+ * calculado a partir do resultado da comparação) e pede ao processador, com antecedência, a linha
+ * de cache dos descendentes alguns níveis abaixo.
+ *
+ * É criada a partir de valores já ordenados (ou com `BinSearchTree::freeze`) e não pode ser
+ * alterada depois.
+ *
+ * @tparam Type
+ */
+template <typename Type>
+class EytzingerTree {
+ private:
+  /**
+   * @brief Quantidade de valores em uma linha de cache de 64 bytes
+   *
+   */
+  static constexpr size_t POR_LINHA = sizeof(Type) >= 64 ? 1 : 64 / sizeof(Type);
+
+  /**
+   * @brief Valores na ordem de Eytzinger (a posição 0 não é usada)
+   *
+   */
+  std::vector<Type> dados;
+
+ public:
+  EytzingerTree() : dados(1) {}
+
+  /**
+   * @brief Constrói a árvore a partir dos valores (já ordenados) de `[primeiro, ultimo)`
+   *
+   * @throw `std::invalid_argument` se os valores não estiverem ordenados
+   */
+  template <typename Iterador>
+  EytzingerTree(Iterador primeiro, Iterador ultimo);
+
+  /**
+   * @brief Verifica se um valor específico está presente na árvore.
+   *
+   * @param valor O valor a ser buscado na árvore
+   */
+  bool search(const Type& valor) const;
+
+  /**
+   * @brief Imprime todos os valores em ordem crescente.
+   *
+   */
+  void inOrder() const;
+
+  /**
+   * @brief Retorna a quantidade de valores na árvore
+   *
+   * @return size_t
+   */
+  size_t size() const;
+
+  /**
+   * @brief Retorna se a árvore está ou não vazia
+   *
+   */
+  bool isEmpty() const;
+
+  /**
+   * @brief Retorna quantos bytes os valores da árvore ocupam
+   *
+   * @return size_t
+   */
+  size_t memoryUsage() const;
+
+ private:
+  /**
+   * @brief Posição do primeiro valor maior ou igual a `valor` (0 se todos forem menores)
+   *
+   */
+  size_t lowerBound(const Type& valor) const;
+
+  /**
+   * @brief Distribui os valores ordenados pelas posições, percorrendo a árvore implícita em ordem
+   *
+   * @param ordenados Valores em ordem crescente
+   * @param proximo Índice do próximo valor de `ordenados` a ser colocado
+   * @param k Posição atual na árvore
+   */
+  void preencher(const std::vector<Type>& ordenados, size_t& proximo, size_t k);
+};
+
+template <typename Type>
+template <typename Iterador>
+EytzingerTree<Type>::EytzingerTree(Iterador primeiro, Iterador ultimo) {
+  std::vector<Type> ordenados(primeiro, ultimo);
+  for (size_t i = 1; i < ordenados.size(); ++i) {
+    if (ordenados[i] < ordenados[i - 1]) {
+      throw std::invalid_argument("Os valores devem estar ordenados");
+    }
+  }
+
+  dados.resize(ordenados.size() + 1);
+  size_t proximo = 0;
+  preencher(ordenados, proximo, 1);
+}
+
+template <typename Type>
+void EytzingerTree<Type>::preencher(const std::vector<Type>& ordenados, size_t& proximo, size_t k) {
+  // A altura da árvore implícita é log2(n), então a recursão é segura
+  if (k >= dados.size()) return;
+
+  preencher(ordenados, proximo, 2 * k);
+  dados[k] = ordenados[proximo++];
+  preencher(ordenados, proximo, 2 * k + 1);
+}
+
+template <typename Type>
+size_t EytzingerTree<Type>::lowerBound(const Type& valor) const {
+  const Type* base = dados.data();
+  size_t n = dados.size() - 1;
+  size_t k = 1;
+
+  while (k <= n) {
+    // Os descendentes de `k` alguns níveis abaixo ocupam posições vizinhas a partir de
+    // `POR_LINHA * k`, ou seja, uma única linha de cache. A dica de prefetch não gera falhas mesmo
+    // que o endereço passe do fim do vetor
+    __builtin_prefetch(reinterpret_cast<const char*>(base) + POR_LINHA * k * sizeof(Type));
+
+    // Vai para a esquerda (2k) ou para a direita (2k + 1) sem desvio condicional
+    k = 2 * k + static_cast<size_t>(base[k] < valor);
+  }
+
+  // Cada passo para a direita acrescentou um bit 1 em `k`. Removendo os passos para a direita do
+  // final do caminho (e o último passo para a esquerda) chega-se ao último nó em que a busca foi
+  // para a esquerda, que é o primeiro valor maior ou igual
+  return k >> __builtin_ffsll(static_cast<long long>(~k));
+}
+
+template <typename Type>
+bool EytzingerTree<Type>::search(const Type& valor) const {
+  size_t k = lowerBound(valor);
+  return k != 0 && dados[k] == valor;
+}
+
+template <typename Type>
+void EytzingerTree<Type>::inOrder() const {
+  size_t n = size();
+  if (n == 0) {
+    std::cout << std::endl;
+    return;
+  }
+
+  // Começa no menor valor (o nó mais à esquerda) e segue para o sucessor de cada nó
+  size_t k = 1;
+  while (2 * k <= n) k *= 2;
+
+  for (size_t i = 0; i < n; ++i) {
+    std::cout << dados[k] << " ";
+
+    if (2 * k + 1 <= n) {
+      // O sucessor é o nó mais à esquerda da subárvore direita
+      k = 2 * k + 1;
+      while (2 * k <= n) k *= 2;
+    } else {
+      // Sobe enquanto o nó for filho direito; o sucessor é o pai do último filho esquerdo
+      while (k % 2 == 1) k /= 2;
+      k /= 2;
+    }
+  }
+  std::cout << std::endl;
+}
+
+template <typename Type>
+size_t EytzingerTree<Type>::size() const {
+  return dados.size() - 1;
+}
+
+template <typename Type>
+bool EytzingerTree<Type>::isEmpty() const {
+  return size() == 0;
+}
+
+template <typename Type>
+size_t EytzingerTree<Type>::memoryUsage() const {
+  return dados.size() * sizeof(Type);
+}
+
+#endif
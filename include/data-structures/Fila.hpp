@@ -2,9 +2,18 @@
 #define FILA_HPP
 
 #include <iostream>
+#include <memory>
 #include <stdexcept>
 
-template <typename Type>
+#include "../allocators/AlocadorMonotonico.hpp"
+
+/**
+ * @brief Fila encadeada
+ *
+ * @tparam Type
+ * @tparam Allocator Alocador usado para os nós (por exemplo, `PoolAllocator` ou `ArenaAllocator`)
+ */
+template <typename Type, typename Allocator = std::allocator<Type>>
 class Fila {
  private:
   struct Node {
@@ -19,14 +28,20 @@ class Fila {
     Node(Type valor) : valor(valor), proximo(nullptr) {}
   };
 
+  using AlocadorNo = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using TraitsNo = std::allocator_traits<AlocadorNo>;
+
   Node* inicio;
   Node* fim;
   size_t tamanho;
+  AlocadorNo alocador;
 
  public:
   // Construtores (o construtor cópia é implementado mais abaixo)
-  Fila() : inicio(nullptr), fim(nullptr), tamanho(0) {};
-  Fila(const Fila<Type>& outraFila);
+  Fila() : Fila(Allocator()) {}
+  explicit Fila(const Allocator& alocador)
+      : inicio(nullptr), fim(nullptr), tamanho(0), alocador(alocador) {}
+  Fila(const Fila<Type, Allocator>& outraFila);
   // Destrutor (implementado mais abaixo)
   ~Fila();
 
@@ -79,10 +94,23 @@ class Fila {
    *
    */
   void print();
+
+  /**
+   * @brief Retorna uma cópia do alocador da fila
+   *
+   * @return Allocator
+   */
+  Allocator get_allocator() const;
+
+ private:
+  Node* criarNo(const Type& valor);
+  void liberarNo(Node* node);
 };
 
-template <typename Type>
-Fila<Type>::Fila(const Fila<Type>& outraFila) : Fila() {
+template <typename Type, typename Allocator>
+Fila<Type, Allocator>::Fila(const Fila<Type, Allocator>& outraFila)
+    : Fila(std::allocator_traits<Allocator>::select_on_container_copy_construction(
+          outraFila.get_allocator())) {
   // Cria um novo nó para o início da outra fila
   Node* atualOrig = outraFila.inicio;
 
@@ -93,15 +121,15 @@ Fila<Type>::Fila(const Fila<Type>& outraFila) : Fila() {
   }
 }
 
-template <typename Type>
-Fila<Type>::~Fila() {
+template <typename Type, typename Allocator>
+Fila<Type, Allocator>::~Fila() {
   clear();
 }
 
-template <typename Type>
-void Fila<Type>::push(Type dado) {
+template <typename Type, typename Allocator>
+void Fila<Type, Allocator>::push(Type dado) {
   // Cria um novo nó
-  Node* novo = new Node(dado);
+  Node* novo = criarNo(dado);
 
   if (isEmpty()) {  // Se a fila estiver vazia
     inicio = novo;  // O início e o fim se tornam o novo nó
@@ -114,8 +142,8 @@ void Fila<Type>::push(Type dado) {
   ++tamanho;
 }
 
-template <typename Type>
-void Fila<Type>::pop() {
+template <typename Type, typename Allocator>
+void Fila<Type, Allocator>::pop() {
   if (isEmpty()) {
     throw std::out_of_range("A fila está vazia");
   }
@@ -127,7 +155,7 @@ void Fila<Type>::pop() {
   inicio = temp->proximo;
 
   // Desaloca o nó temporário
-  delete temp;
+  liberarNo(temp);
 
   --tamanho;
 
@@ -137,8 +165,8 @@ void Fila<Type>::pop() {
   }
 }
 
-template <typename Type>
-Type Fila<Type>::front() {
+template <typename Type, typename Allocator>
+Type Fila<Type, Allocator>::front() {
   if (isEmpty()) {
     throw std::out_of_range("A pilha está vazia");
   }
@@ -146,25 +174,35 @@ Type Fila<Type>::front() {
   return inicio->valor;
 }
 
-template <typename Type>
-bool Fila<Type>::isEmpty() const {
+template <typename Type, typename Allocator>
+bool Fila<Type, Allocator>::isEmpty() const {
   return inicio == nullptr;
 }
 
-template <typename Type>
-size_t Fila<Type>::size() {
+template <typename Type, typename Allocator>
+size_t Fila<Type, Allocator>::size() {
   return tamanho;
 }
 
-template <typename Type>
-void Fila<Type>::clear() {
-  while (!isEmpty()) {
-    pop();
+template <typename Type, typename Allocator>
+void Fila<Type, Allocator>::clear() {
+  // Com uma arena e valores de destrutor trivial, os nós são abandonados sem serem percorridos
+  if (!DescarteSemPercurso<Allocator, Type>::value) {
+    Node* atual = inicio;
+    while (atual != nullptr) {
+      Node* posterior = atual->proximo;
+      liberarNo(atual);
+      atual = posterior;
+    }
   }
+
+  inicio = nullptr;
+  fim = nullptr;
+  tamanho = 0;
 }
 
-template <typename Type>
-void Fila<Type>::print() {
+template <typename Type, typename Allocator>
+void Fila<Type, Allocator>::print() {
   if (isEmpty()) {
     std::cout << "Fila vazia!" << std::endl;
     return;
@@ -178,4 +216,27 @@ void Fila<Type>::print() {
   std::cout << std::endl;
 }
 
+template <typename Type, typename Allocator>
+Allocator Fila<Type, Allocator>::get_allocator() const {
+  return Allocator(alocador);
+}
+
+template <typename Type, typename Allocator>
+typename Fila<Type, Allocator>::Node* Fila<Type, Allocator>::criarNo(const Type& valor) {
+  Node* node = TraitsNo::allocate(alocador, 1);
+  try {
+    TraitsNo::construct(alocador, node, valor);
+  } catch (...) {
+    TraitsNo::deallocate(alocador, node, 1);
+    throw;
+  }
+  return node;
+}
+
+template <typename Type, typename Allocator>
+void Fila<Type, Allocator>::liberarNo(typename Fila<Type, Allocator>::Node* node) {
+  TraitsNo::destroy(alocador, node);
+  TraitsNo::deallocate(alocador, node, 1);
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,276 @@
+#ifndef FILA_BLOCOS_HPP
+#define FILA_BLOCOS_HPP
+
+#include <iostream>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+/**
+ * @brief Fila armazenada em blocos contíguos de tamanho fixo
+ *
+ * Cada bloco guarda até `TamanhoBloco` elementos e funciona como um buffer circular. Os blocos são
+ * encadeados do início ao fim da fila; quando o bloco do início esvazia ele é guardado em uma lista
+ * de blocos livres e reaproveitado pelos próximos `push`, em vez de ser desalocado. Dessa forma, em
+ * regime estável a fila não faz nenhuma alocação e elementos vizinhos ficam na mesma linha de cache.
+ *
+ * @tparam Type
+ * @tparam TamanhoBloco Quantidade de elementos por bloco
+ */
+template <typename Type, size_t TamanhoBloco = 64>
+class FilaBlocos {
+  static_assert(TamanhoBloco > 0, "O bloco precisa ter pelo menos um elemento");
+
+ private:
+  struct Bloco {
+    /**
+     * @brief Memória (não inicializada) dos elementos do bloco
+     *
+     */
+    Type* dados;
+
+    /**
+     * @brief Índice do primeiro elemento do bloco
+     *
+     */
+    size_t inicio;
+
+    /**
+     * @brief Quantidade de elementos no bloco
+     *
+     */
+    size_t quantidade;
+
+    /**
+     * @brief Aponta para o próximo bloco
+     *
+     */
+    Bloco* proximo;
+
+    Bloco()
+        : dados(static_cast<Type*>(::operator new(sizeof(Type) * TamanhoBloco))),
+          inicio(0),
+          quantidade(0),
+          proximo(nullptr) {}
+
+    ~Bloco() { ::operator delete(dados); }
+  };
+
+  Bloco* inicio;
+  Bloco* fim;
+
+  /**
+   * @brief Blocos vazios prontos para serem reaproveitados
+   *
+   */
+  Bloco* livres;
+
+  size_t tamanho;
+
+ public:
+  // Construtores (o construtor cópia é implementado mais abaixo)
+  FilaBlocos() : inicio(nullptr), fim(nullptr), livres(nullptr), tamanho(0) {};
+  FilaBlocos(const FilaBlocos<Type, TamanhoBloco>& outraFila);
+  FilaBlocos<Type, TamanhoBloco>& operator=(const FilaBlocos<Type, TamanhoBloco>&) = delete;
+  // Destrutor (implementado mais abaixo)
+  ~FilaBlocos();
+
+  /**
+   * @brief Adiciona um novo elemento na fila
+   *
+   * @param dado Novo dado que será adicionado na fila
+   */
+  void push(Type dado);
+
+  /**
+   * @brief Remove o primeiro elemento da fila
+   *
+   * @throw `std::out_of_range` se a fila estiver vazia
+   */
+  void pop();
+
+  /**
+   * @brief Retorna o primeiro elemento da fila
+   *
+   * @return Type
+   *
+   * @throw `std::out_of_range` se a fila estiver vazia
+   */
+  Type front();
+
+  /**
+   * @brief Retorna se a fila está ou não vazia
+   *
+   * @return true se a fila estiver vazia
+   * @return false se a fila não estiver vazia
+   */
+  bool isEmpty() const;
+
+  /**
+   * @brief Retorna o tamanho da fila
+   *
+   * @return size_t
+   */
+  size_t size();
+
+  /**
+   * @brief Limpa (reseta) completamente a fila
+   *
+   * Os blocos usados são mantidos na lista de livres para os próximos `push`.
+   */
+  void clear();
+
+  /**
+   * @brief Imprime todos elementos da fila
+   *
+   */
+  void print();
+
+ private:
+  /**
+   * @brief Obtém um bloco vazio, reaproveitando um bloco livre quando houver
+   *
+   * @return Bloco*
+   */
+  Bloco* novoBloco();
+
+  /**
+   * @brief Devolve um bloco vazio para a lista de livres
+   *
+   * @param bloco Bloco que não possui mais elementos
+   */
+  void reciclar(Bloco* bloco);
+};
+
+template <typename Type, size_t TamanhoBloco>
+FilaBlocos<Type, TamanhoBloco>::FilaBlocos(const FilaBlocos<Type, TamanhoBloco>& outraFila)
+    : FilaBlocos() {
+  // Percorre os blocos da outra fila adicionando cópias de seus elementos na fila cópia
+  for (Bloco* bloco = outraFila.inicio; bloco != nullptr; bloco = bloco->proximo) {
+    for (size_t i = 0; i < bloco->quantidade; ++i) {
+      push(bloco->dados[(bloco->inicio + i) % TamanhoBloco]);
+    }
+  }
+}
+
+template <typename Type, size_t TamanhoBloco>
+FilaBlocos<Type, TamanhoBloco>::~FilaBlocos() {
+  clear();
+
+  while (livres != nullptr) {
+    Bloco* temp = livres;
+    livres = livres->proximo;
+    delete temp;
+  }
+}
+
+template <typename Type, size_t TamanhoBloco>
+typename FilaBlocos<Type, TamanhoBloco>::Bloco* FilaBlocos<Type, TamanhoBloco>::novoBloco() {
+  if (livres == nullptr) {
+    return new Bloco();
+  }
+
+  Bloco* bloco = livres;
+  livres = livres->proximo;
+
+  bloco->inicio = 0;
+  bloco->quantidade = 0;
+  bloco->proximo = nullptr;
+  return bloco;
+}
+
+template <typename Type, size_t TamanhoBloco>
+void FilaBlocos<Type, TamanhoBloco>::reciclar(typename FilaBlocos<Type, TamanhoBloco>::Bloco* bloco) {
+  bloco->proximo = livres;
+  livres = bloco;
+}
+
+template <typename Type, size_t TamanhoBloco>
+void FilaBlocos<Type, TamanhoBloco>::push(Type dado) {
+  if (fim == nullptr) {  // Se a fila não tiver nenhum bloco
+    inicio = novoBloco();
+    fim = inicio;
+  } else if (fim->quantidade == TamanhoBloco) {  // Se o último bloco estiver cheio
+    fim->proximo = novoBloco();
+    fim = fim->proximo;
+  }
+
+  // A posição livre seguinte ao último elemento, dando a volta no bloco se necessário
+  size_t posicao = (fim->inicio + fim->quantidade) % TamanhoBloco;
+  new (fim->dados + posicao) Type(std::move(dado));
+
+  ++fim->quantidade;
+  ++tamanho;
+}
+
+template <typename Type, size_t TamanhoBloco>
+void FilaBlocos<Type, TamanhoBloco>::pop() {
+  if (isEmpty()) {
+    throw std::out_of_range("A fila está vazia");
+  }
+
+  inicio->dados[inicio->inicio].~Type();
+  inicio->inicio = (inicio->inicio + 1) % TamanhoBloco;
+  --inicio->quantidade;
+  --tamanho;
+
+  // O bloco do início só é reciclado se houver outro bloco depois dele. O último bloco continua
+  // sendo usado como buffer circular
+  if (inicio->quantidade == 0 && inicio != fim) {
+    Bloco* temp = inicio;
+    inicio = inicio->proximo;
+    reciclar(temp);
+  }
+}
+
+template <typename Type, size_t TamanhoBloco>
+Type FilaBlocos<Type, TamanhoBloco>::front() {
+  if (isEmpty()) {
+    throw std::out_of_range("A fila está vazia");
+  }
+
+  return inicio->dados[inicio->inicio];
+}
+
+template <typename Type, size_t TamanhoBloco>
+bool FilaBlocos<Type, TamanhoBloco>::isEmpty() const {
+  return tamanho == 0;
+}
+
+template <typename Type, size_t TamanhoBloco>
+size_t FilaBlocos<Type, TamanhoBloco>::size() {
+  return tamanho;
+}
+
+template <typename Type, size_t TamanhoBloco>
+void FilaBlocos<Type, TamanhoBloco>::clear() {
+  while (inicio != nullptr) {
+    for (size_t i = 0; i < inicio->quantidade; ++i) {
+      inicio->dados[(inicio->inicio + i) % TamanhoBloco].~Type();
+    }
+
+    Bloco* temp = inicio;
+    inicio = inicio->proximo;
+    reciclar(temp);
+  }
+
+  fim = nullptr;
+  tamanho = 0;
+}
+
+template <typename Type, size_t TamanhoBloco>
+void FilaBlocos<Type, TamanhoBloco>::print() {
+  if (isEmpty()) {
+    std::cout << "Fila vazia!" << std::endl;
+    return;
+  }
+
+  for (Bloco* bloco = inicio; bloco != nullptr; bloco = bloco->proximo) {
+    for (size_t i = 0; i < bloco->quantidade; ++i) {
+      std::cout << bloco->dados[(bloco->inicio + i) % TamanhoBloco] << " ";
+    }
+  }
+  std::cout << std::endl;
+}
+
+#endif
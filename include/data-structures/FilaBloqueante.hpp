@@ -0,0 +1,292 @@
+#ifndef FILA_BLOQUEANTE_HPP
+#define FILA_BLOQUEANTE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+#include "Fila.hpp"
+
+/**
+ * @brief Fila bloqueante para pipelines produtor-consumidor, construída sobre a `Fila`
+ *
+ * Consumidores que encontram a fila vazia primeiro fazem uma espera ativa curta (o caso comum de um
+ * item chegando logo em seguida não paga o custo de dormir e acordar) e só então dormem em uma
+ * variável de condição. Cada `push` acorda no máximo um consumidor e `push_n` acorda no máximo um
+ * consumidor por item novo, e nenhum `notify` é feito quando não há ninguém dormindo.
+ *
+ * Depois de `close()`, novos `push` são recusados e os consumidores esvaziam o que restou na fila
+ * antes de receberem `false`.
+ *
+ * @tparam Type
+ */
+template <typename Type>
+class FilaBloqueante {
+ private:
+  /**
+   * @brief Número de tentativas da espera ativa antes de dormir na variável de condição
+   *
+   */
+  static constexpr int LIMITE_ESPERA_ATIVA = 2000;
+
+  Fila<Type> fila;
+
+  mutable std::mutex trava;
+  std::condition_variable temItem;
+
+  /**
+   * @brief Cópia do tamanho da fila, lida sem a trava durante a espera ativa
+   *
+   */
+  std::atomic<size_t> tamanho;
+
+  std::atomic<bool> fechada;
+
+  /**
+   * @brief Quantidade de consumidores dormindo na variável de condição (protegido por `trava`)
+   *
+   */
+  size_t esperando;
+
+ public:
+  FilaBloqueante() : tamanho(0), fechada(false), esperando(0) {}
+  FilaBloqueante(const FilaBloqueante<Type>&) = delete;
+  FilaBloqueante<Type>& operator=(const FilaBloqueante<Type>&) = delete;
+
+  /**
+   * @brief Adiciona um novo elemento na fila e acorda um consumidor, se houver algum dormindo
+   *
+   * @param dado Novo dado que será adicionado na fila
+   *
+   * @throw `std::logic_error` se a fila estiver fechada
+   */
+  void push(Type dado);
+
+  /**
+   * @brief Adiciona os elementos de `[primeiro, ultimo)` de uma só vez
+   *
+   * Acorda no máximo um consumidor por elemento adicionado.
+   *
+   * @throw `std::logic_error` se a fila estiver fechada
+   */
+  template <typename Iterador>
+  void push_n(Iterador primeiro, Iterador ultimo);
+
+  /**
+   * @brief Remove o primeiro elemento da fila sem bloquear
+   *
+   * @param saida Recebe o elemento removido
+   * @return false se a fila estiver vazia
+   */
+  bool try_pop(Type& saida);
+
+  /**
+   * @brief Remove o primeiro elemento da fila, aguardando até que exista um
+   *
+   * @param saida Recebe o elemento removido
+   * @return false se a fila foi fechada e não há mais elementos
+   */
+  bool pop_wait(Type& saida);
+
+  /**
+   * @brief Remove o primeiro elemento da fila, aguardando no máximo `limite`
+   *
+   * @param saida Recebe o elemento removido
+   * @param limite Tempo máximo de espera
+   * @return false se o tempo acabou ou se a fila foi fechada e não há mais elementos
+   */
+  template <typename Rep, typename Period>
+  bool pop_wait_for(Type& saida, const std::chrono::duration<Rep, Period>& limite);
+
+  /**
+   * @brief Fecha a fila e acorda todos os consumidores
+   *
+   */
+  void close();
+
+  /**
+   * @brief Retorna se a fila foi fechada
+   *
+   */
+  bool isClosed() const;
+
+  /**
+   * @brief Retorna se a fila está ou não vazia
+   *
+   */
+  bool isEmpty() const;
+
+  /**
+   * @brief Retorna o tamanho da fila
+   *
+   * @return size_t
+   */
+  size_t size() const;
+
+ private:
+  /**
+   * @brief Espera ativa curta até a fila ter elementos ou ser fechada
+   *
+   */
+  void esperaAtiva() const;
+
+  /**
+   * @brief Remove o primeiro elemento da fila (a trava já deve estar adquirida)
+   *
+   */
+  bool retirar(Type& saida);
+};
+
+template <typename Type>
+void FilaBloqueante<Type>::push(Type dado) {
+  size_t acordar;
+  {
+    std::lock_guard<std::mutex> guarda(trava);
+    if (fechada.load(std::memory_order_relaxed)) {
+      throw std::logic_error("A fila esta fechada");
+    }
+
+    fila.push(dado);
+    tamanho.store(fila.size(), std::memory_order_release);
+    acordar = esperando;
+  }
+
+  // O notify é feito fora da trava para que o consumidor acordado não bloqueie nela em seguida
+  if (acordar > 0) {
+    temItem.notify_one();
+  }
+}
+
+template <typename Type>
+template <typename Iterador>
+void FilaBloqueante<Type>::push_n(Iterador primeiro, Iterador ultimo) {
+  size_t novos = 0;
+  size_t acordar;
+  {
+    std::lock_guard<std::mutex> guarda(trava);
+    if (fechada.load(std::memory_order_relaxed)) {
+      throw std::logic_error("A fila esta fechada");
+    }
+
+    for (; primeiro != ultimo; ++primeiro, ++novos) {
+      fila.push(*primeiro);
+    }
+    tamanho.store(fila.size(), std::memory_order_release);
+    acordar = std::min(novos, esperando);
+  }
+
+  for (size_t i = 0; i < acordar; ++i) {
+    temItem.notify_one();
+  }
+}
+
+template <typename Type>
+bool FilaBloqueante<Type>::retirar(Type& saida) {
+  if (fila.isEmpty()) {
+    return false;
+  }
+
+  saida = fila.front();
+  fila.pop();
+  tamanho.store(fila.size(), std::memory_order_release);
+  return true;
+}
+
+template <typename Type>
+bool FilaBloqueante<Type>::try_pop(Type& saida) {
+  if (tamanho.load(std::memory_order_acquire) == 0) {
+    return false;
+  }
+
+  std::lock_guard<std::mutex> guarda(trava);
+  return retirar(saida);
+}
+
+template <typename Type>
+void FilaBloqueante<Type>::esperaAtiva() const {
+  for (int i = 0; i < LIMITE_ESPERA_ATIVA; ++i) {
+    if (tamanho.load(std::memory_order_acquire) > 0 || fechada.load(std::memory_order_acquire)) {
+      return;
+    }
+
+    // Nas primeiras tentativas só relê o contador; depois cede o processador a outras threads
+    if (i > LIMITE_ESPERA_ATIVA / 2) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+template <typename Type>
+bool FilaBloqueante<Type>::pop_wait(Type& saida) {
+  esperaAtiva();
+
+  std::unique_lock<std::mutex> guarda(trava);
+  while (fila.isEmpty()) {
+    if (fechada.load(std::memory_order_relaxed)) {
+      return false;
+    }
+
+    ++esperando;
+    temItem.wait(guarda);
+    --esperando;
+  }
+
+  return retirar(saida);
+}
+
+template <typename Type>
+template <typename Rep, typename Period>
+bool FilaBloqueante<Type>::pop_wait_for(Type& saida,
+                                        const std::chrono::duration<Rep, Period>& limite) {
+  auto prazo = std::chrono::steady_clock::now() + limite;
+
+  esperaAtiva();
+
+  std::unique_lock<std::mutex> guarda(trava);
+  while (fila.isEmpty()) {
+    if (fechada.load(std::memory_order_relaxed)) {
+      return false;
+    }
+
+    ++esperando;
+    std::cv_status status = temItem.wait_until(guarda, prazo);
+    --esperando;
+
+    if (status == std::cv_status::timeout) {
+      return retirar(saida);
+    }
+  }
+
+  return retirar(saida);
+}
+
+template <typename Type>
+void FilaBloqueante<Type>::close() {
+  {
+    std::lock_guard<std::mutex> guarda(trava);
+    fechada.store(true, std::memory_order_release);
+  }
+
+  temItem.notify_all();
+}
+
+template <typename Type>
+bool FilaBloqueante<Type>::isClosed() const {
+  return fechada.load(std::memory_order_acquire);
+}
+
+template <typename Type>
+bool FilaBloqueante<Type>::isEmpty() const {
+  return size() == 0;
+}
+
+template <typename Type>
+size_t FilaBloqueante<Type>::size() const {
+  return tamanho.load(std::memory_order_acquire);
+}
+
+#endif
@@ -0,0 +1,151 @@
+#ifndef FILA_INTRUSIVA_HPP
+#define FILA_INTRUSIVA_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+
+#include "Gancho.hpp"
+
+/**
+ * @brief Fila intrusiva
+ *
+ * Guarda objetos que herdam `Gancho<Marca>` ligando os ganchos deles, sem alocar nem copiar nada:
+ * a fila não é dona dos objetos, que precisam viver enquanto estiverem ligados.
+ *
+ * A fila é circular e guarda apenas o último gancho: o próximo do último é o primeiro. Assim todo
+ * gancho ligado tem `proximo` diferente de `nullptr`, o que permite detectar ligações duplas.
+ *
+ * @tparam Type Tipo dos objetos, que precisa herdar `Gancho<Marca>`
+ * @tparam Marca Marca do gancho usado por esta fila
+ */
+template <typename Type, typename Marca = void>
+class FilaIntrusiva {
+ private:
+  using GanchoFila = Gancho<Marca>;
+
+  /**
+   * @brief Último gancho da fila (`nullptr` se a fila estiver vazia)
+   *
+   */
+  GanchoFila* ultimo;
+
+  size_t tamanho;
+
+ public:
+  FilaIntrusiva() : ultimo(nullptr), tamanho(0) {}
+  FilaIntrusiva(const FilaIntrusiva<Type, Marca>&) = delete;
+  FilaIntrusiva<Type, Marca>& operator=(const FilaIntrusiva<Type, Marca>&) = delete;
+  // Destrutor (implementado mais abaixo): desliga os objetos, sem destruí-los
+  ~FilaIntrusiva();
+
+  /**
+   * @brief Liga um objeto no final da fila, em O(1)
+   *
+   * @param objeto Objeto que ainda não está ligado por este gancho
+   */
+  void push(Type& objeto);
+
+  /**
+   * @brief Desliga o primeiro objeto da fila, em O(1)
+   *
+   * @throw `std::out_of_range` se a fila estiver vazia
+   */
+  void pop();
+
+  /**
+   * @brief Retorna o primeiro objeto da fila
+   *
+   * @throw `std::out_of_range` se a fila estiver vazia
+   */
+  Type& front();
+
+  /**
+   * @brief Retorna se a fila está ou não vazia
+   *
+   * @return true se a fila estiver vazia
+   * @return false se a fila não estiver vazia
+   */
+  bool isEmpty() const;
+
+  /**
+   * @brief Retorna o tamanho da fila
+   *
+   * @return size_t
+   */
+  size_t size() const;
+
+  /**
+   * @brief Desliga todos os objetos da fila (os objetos não são destruídos)
+   *
+   */
+  void clear();
+};
+
+template <typename Type, typename Marca>
+FilaIntrusiva<Type, Marca>::~FilaIntrusiva() {
+  clear();
+}
+
+template <typename Type, typename Marca>
+void FilaIntrusiva<Type, Marca>::push(Type& objeto) {
+  GanchoFila* gancho = &static_cast<GanchoFila&>(objeto);
+  assert(!gancho->ligado() && "O objeto ja esta ligado a um container");
+
+  if (ultimo == nullptr) {
+    gancho->proximo = gancho;  // Sozinho, o gancho é o primeiro e o último
+  } else {
+    gancho->proximo = ultimo->proximo;  // O novo último aponta para o primeiro
+    ultimo->proximo = gancho;
+  }
+
+  ultimo = gancho;
+  ++tamanho;
+}
+
+template <typename Type, typename Marca>
+void FilaIntrusiva<Type, Marca>::pop() {
+  if (isEmpty()) {
+    throw std::out_of_range("A fila está vazia");
+  }
+
+  GanchoFila* primeiro = ultimo->proximo;
+
+  if (primeiro == ultimo) {
+    ultimo = nullptr;
+  } else {
+    ultimo->proximo = primeiro->proximo;
+  }
+
+  primeiro->proximo = nullptr;
+  --tamanho;
+}
+
+template <typename Type, typename Marca>
+Type& FilaIntrusiva<Type, Marca>::front() {
+  if (isEmpty()) {
+    throw std::out_of_range("A fila está vazia");
+  }
+
+  return static_cast<Type&>(*ultimo->proximo);
+}
+
+template <typename Type, typename Marca>
+bool FilaIntrusiva<Type, Marca>::isEmpty() const {
+  return ultimo == nullptr;
+}
+
+template <typename Type, typename Marca>
+size_t FilaIntrusiva<Type, Marca>::size() const {
+  return tamanho;
+}
+
+template <typename Type, typename Marca>
+void FilaIntrusiva<Type, Marca>::clear() {
+  // Os ganchos são anulados para que os objetos possam ser ligados de novo (ou destruídos)
+  while (!isEmpty()) {
+    pop();
+  }
+}
+
+#endif
@@ -0,0 +1,285 @@
+#ifndef FILA_MPMC_HPP
+#define FILA_MPMC_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+/**
+ * @brief Fila limitada para vários produtores e vários consumidores (MPMC)
+ *
+ * Implementação baseada na fila de Dmitry Vyukov: cada posição do buffer circular possui um número
+ * de sequência que indica se ela está livre para o produtor da volta atual ou pronta para o
+ * consumidor. Produtores disputam apenas o índice `fim` e consumidores apenas o índice `inicio`.
+ *
+ * As operações em lote (`push_n`/`pop_n`) reservam várias posições consecutivas com um único
+ * compare-and-swap e depois preenchem/esvaziam cada posição reservada.
+ *
+ * @tparam Type Precisa ter construtor padrão e atribuição por movimento
+ */
+template <typename Type>
+class FilaMPMC {
+ private:
+  static constexpr size_t LINHA_CACHE = 64;
+
+  struct Celula {
+    /**
+     * @brief Número de sequência da posição
+     *
+     * Igual à posição quando está livre para ser escrita e igual à posição + 1 quando contém um
+     * elemento pronto para ser lido.
+     */
+    std::atomic<size_t> sequencia;
+    Type valor;
+  };
+
+  Celula* celulas;
+  size_t capacidade;
+  size_t mascara;
+
+  alignas(LINHA_CACHE) std::atomic<size_t> fim;
+  alignas(LINHA_CACHE) std::atomic<size_t> inicio;
+
+  // Evita que o próximo objeto na memória divida a linha de cache com `inicio`
+  char preenchimento[LINHA_CACHE - sizeof(std::atomic<size_t>)];
+
+ public:
+  /**
+   * @brief Cria uma fila com pelo menos `capacidadeMinima` posições
+   *
+   * A capacidade é arredondada para a próxima potência de 2 (no mínimo 2).
+   *
+   * @throw `std::invalid_argument` se a capacidade for 0
+   */
+  explicit FilaMPMC(size_t capacidadeMinima);
+  FilaMPMC(const FilaMPMC<Type>&) = delete;
+  FilaMPMC<Type>& operator=(const FilaMPMC<Type>&) = delete;
+  ~FilaMPMC();
+
+  /**
+   * @brief Tenta adicionar um elemento na fila
+   *
+   * @param dado Novo dado que será adicionado na fila
+   * @return false se a fila estiver cheia
+   */
+  bool try_push(Type dado);
+
+  /**
+   * @brief Tenta remover o primeiro elemento da fila
+   *
+   * @param saida Recebe o elemento removido
+   * @return false se a fila estiver vazia
+   */
+  bool try_pop(Type& saida);
+
+  /**
+   * @brief Reserva até `quantidade` posições com uma única operação atômica e as preenche
+   *
+   * @param dados Elementos que serão copiados para a fila
+   * @param quantidade Número de elementos em `dados`
+   * @return size_t Número de elementos efetivamente adicionados (0 se a fila estiver cheia)
+   */
+  size_t push_n(const Type* dados, size_t quantidade);
+
+  /**
+   * @brief Reserva até `quantidade` elementos com uma única operação atômica e os remove
+   *
+   * @param saida Destino dos elementos removidos
+   * @param quantidade Número máximo de elementos a remover
+   * @return size_t Número de elementos efetivamente removidos (0 se a fila estiver vazia)
+   */
+  size_t pop_n(Type* saida, size_t quantidade);
+
+  /**
+   * @brief Retorna o número aproximado de elementos na fila
+   *
+   * @return size_t
+   */
+  size_t size() const;
+
+  /**
+   * @brief Retorna se a fila está (aproximadamente) vazia
+   *
+   */
+  bool isEmpty() const;
+
+  /**
+   * @brief Retorna a capacidade da fila
+   *
+   * @return size_t
+   */
+  size_t capacity() const;
+
+ private:
+  /**
+   * @brief Aguarda até que a sequência da célula atinja o valor esperado
+   *
+   * Usado pelas operações em lote: a posição já foi reservada, mas a thread da volta anterior
+   * ainda pode estar terminando de escrevê-la/lê-la.
+   */
+  static void aguardar(const Celula& celula, size_t esperado);
+};
+
+template <typename Type>
+FilaMPMC<Type>::FilaMPMC(size_t capacidadeMinima)
+    : celulas(nullptr), capacidade(2), mascara(0), fim(0), inicio(0) {
+  if (capacidadeMinima == 0) {
+    throw std::invalid_argument("A capacidade da fila deve ser maior que 0");
+  }
+
+  while (capacidade < capacidadeMinima) {
+    capacidade <<= 1;
+  }
+  mascara = capacidade - 1;
+
+  celulas = new Celula[capacidade];
+  for (size_t i = 0; i < capacidade; ++i) {
+    celulas[i].sequencia.store(i, std::memory_order_relaxed);
+  }
+}
+
+template <typename Type>
+FilaMPMC<Type>::~FilaMPMC() {
+  delete[] celulas;
+}
+
+template <typename Type>
+void FilaMPMC<Type>::aguardar(const Celula& celula, size_t esperado) {
+  while (celula.sequencia.load(std::memory_order_acquire) != esperado) {
+    std::this_thread::yield();
+  }
+}
+
+template <typename Type>
+bool FilaMPMC<Type>::try_push(Type dado) {
+  size_t posicao = fim.load(std::memory_order_relaxed);
+
+  while (true) {
+    Celula& celula = celulas[posicao & mascara];
+    size_t sequencia = celula.sequencia.load(std::memory_order_acquire);
+    intptr_t diferenca = static_cast<intptr_t>(sequencia) - static_cast<intptr_t>(posicao);
+
+    if (diferenca == 0) {  // A posição está livre: tenta reservá-la
+      if (fim.compare_exchange_weak(posicao, posicao + 1, std::memory_order_relaxed)) {
+        celula.valor = std::move(dado);
+        celula.sequencia.store(posicao + 1, std::memory_order_release);
+        return true;
+      }
+    } else if (diferenca < 0) {  // A posição ainda guarda um elemento da volta anterior
+      return false;
+    } else {  // Outro produtor já reservou a posição
+      posicao = fim.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+template <typename Type>
+bool FilaMPMC<Type>::try_pop(Type& saida) {
+  size_t posicao = inicio.load(std::memory_order_relaxed);
+
+  while (true) {
+    Celula& celula = celulas[posicao & mascara];
+    size_t sequencia = celula.sequencia.load(std::memory_order_acquire);
+    intptr_t diferenca = static_cast<intptr_t>(sequencia) - static_cast<intptr_t>(posicao + 1);
+
+    if (diferenca == 0) {  // A posição tem um elemento pronto: tenta reservá-la
+      if (inicio.compare_exchange_weak(posicao, posicao + 1, std::memory_order_relaxed)) {
+        saida = std::move(celula.valor);
+        celula.sequencia.store(posicao + capacidade, std::memory_order_release);
+        return true;
+      }
+    } else if (diferenca < 0) {  // Nenhum elemento foi publicado nessa posição ainda
+      return false;
+    } else {  // Outro consumidor já reservou a posição
+      posicao = inicio.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+template <typename Type>
+size_t FilaMPMC<Type>::push_n(const Type* dados, size_t quantidade) {
+  if (quantidade == 0) return 0;
+
+  size_t posicao = fim.load(std::memory_order_relaxed);
+  size_t reservados;
+
+  do {
+    // Só podem ser reservadas posições que algum consumidor já reservou na volta anterior; assim
+    // a espera em `aguardar` é sempre por uma thread que já está no meio da sua operação
+    size_t consumidos = inicio.load(std::memory_order_acquire);
+    size_t ocupados = posicao - consumidos;
+    if (static_cast<intptr_t>(ocupados) < 0) {
+      // `posicao` ficou desatualizada em relação a `inicio`; relê e tenta novamente
+      posicao = fim.load(std::memory_order_relaxed);
+      continue;
+    }
+    if (ocupados >= capacidade) return 0;
+
+    reservados = std::min(quantidade, capacidade - ocupados);
+    if (fim.compare_exchange_weak(posicao, posicao + reservados, std::memory_order_relaxed)) {
+      break;
+    }
+  } while (true);
+
+  for (size_t i = 0; i < reservados; ++i) {
+    Celula& celula = celulas[(posicao + i) & mascara];
+    aguardar(celula, posicao + i);
+    celula.valor = dados[i];
+    celula.sequencia.store(posicao + i + 1, std::memory_order_release);
+  }
+
+  return reservados;
+}
+
+template <typename Type>
+size_t FilaMPMC<Type>::pop_n(Type* saida, size_t quantidade) {
+  if (quantidade == 0) return 0;
+
+  size_t posicao = inicio.load(std::memory_order_relaxed);
+  size_t reservados;
+
+  do {
+    // Só podem ser reservados elementos que algum produtor já reservou. Como `inicio` nunca
+    // ultrapassa `fim` e `fim` é lido depois de `posicao`, a diferença nunca é negativa
+    size_t produzidos = fim.load(std::memory_order_acquire);
+    size_t disponiveis = produzidos - posicao;
+    if (disponiveis == 0) return 0;
+
+    reservados = std::min(quantidade, disponiveis);
+    if (inicio.compare_exchange_weak(posicao, posicao + reservados, std::memory_order_relaxed)) {
+      break;
+    }
+  } while (true);
+
+  for (size_t i = 0; i < reservados; ++i) {
+    Celula& celula = celulas[(posicao + i) & mascara];
+    aguardar(celula, posicao + i + 1);
+    saida[i] = std::move(celula.valor);
+    celula.sequencia.store(posicao + i + capacidade, std::memory_order_release);
+  }
+
+  return reservados;
+}
+
+template <typename Type>
+size_t FilaMPMC<Type>::size() const {
+  size_t primeiro = inicio.load(std::memory_order_acquire);
+  size_t ultimo = fim.load(std::memory_order_acquire);
+  return ultimo > primeiro ? ultimo - primeiro : 0;
+}
+
+template <typename Type>
+bool FilaMPMC<Type>::isEmpty() const {
+  return size() == 0;
+}
+
+template <typename Type>
+size_t FilaMPMC<Type>::capacity() const {
+  return capacidade;
+}
+
+#endif
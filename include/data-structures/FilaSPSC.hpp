@@ -0,0 +1,285 @@
+#ifndef FILA_SPSC_HPP
+#define FILA_SPSC_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+/**
+ * @brief Fila sem travas para um único produtor e um único consumidor (SPSC)
+ *
+ * A fila é um buffer circular de capacidade fixa. Apenas a thread produtora escreve o índice `fim`
+ * e apenas a thread consumidora escreve o índice `inicio`, então basta publicar cada índice com
+ * `release` e lê-lo do outro lado com `acquire`. Cada índice fica em sua própria linha de cache
+ * para que produtor e consumidor não disputem a mesma linha (false sharing), e cada lado guarda uma
+ * cópia local do índice do outro lado para só precisar relê-lo quando a fila parecer cheia/vazia.
+ *
+ * @tparam Type
+ */
+template <typename Type>
+class FilaSPSC {
+ private:
+  static constexpr size_t LINHA_CACHE = 64;
+
+  /**
+   * @brief Memória (não inicializada) dos elementos da fila
+   *
+   */
+  Type* dados;
+
+  /**
+   * @brief Capacidade do buffer (sempre potência de 2)
+   *
+   */
+  size_t capacidade;
+
+  /**
+   * @brief Máscara utilizada no lugar do resto da divisão pela capacidade
+   *
+   */
+  size_t mascara;
+
+  /**
+   * @brief Posição do próximo elemento a ser removido (escrito pelo consumidor)
+   *
+   */
+  alignas(LINHA_CACHE) std::atomic<size_t> inicio;
+
+  /**
+   * @brief Cópia local de `fim` mantida pelo consumidor
+   *
+   */
+  size_t fimCache;
+
+  /**
+   * @brief Posição onde o próximo elemento será inserido (escrito pelo produtor)
+   *
+   */
+  alignas(LINHA_CACHE) std::atomic<size_t> fim;
+
+  /**
+   * @brief Cópia local de `inicio` mantida pelo produtor
+   *
+   */
+  size_t inicioCache;
+
+  // Evita que o próximo objeto na memória divida a linha de cache com `fim`
+  char preenchimento[LINHA_CACHE - sizeof(std::atomic<size_t>) - sizeof(size_t)];
+
+ public:
+  /**
+   * @brief Cria uma fila com pelo menos `capacidadeMinima` posições
+   *
+   * A capacidade é arredondada para a próxima potência de 2.
+   *
+   * @throw `std::invalid_argument` se a capacidade for 0
+   */
+  explicit FilaSPSC(size_t capacidadeMinima);
+  FilaSPSC(const FilaSPSC<Type>&) = delete;
+  FilaSPSC<Type>& operator=(const FilaSPSC<Type>&) = delete;
+  ~FilaSPSC();
+
+  /**
+   * @brief Tenta adicionar um elemento na fila (somente a thread produtora)
+   *
+   * @param dado Novo dado que será adicionado na fila
+   * @return false se a fila estiver cheia
+   */
+  bool try_push(const Type& dado);
+  bool try_push(Type&& dado);
+
+  /**
+   * @brief Tenta remover o primeiro elemento da fila (somente a thread consumidora)
+   *
+   * @param saida Recebe o elemento removido
+   * @return false se a fila estiver vazia
+   */
+  bool try_pop(Type& saida);
+
+  /**
+   * @brief Adiciona até `quantidade` elementos publicando o novo fim uma única vez
+   *
+   * @param dados Elementos que serão copiados para a fila
+   * @param quantidade Número de elementos em `dados`
+   * @return size_t Número de elementos efetivamente adicionados
+   */
+  size_t push_n(const Type* dados, size_t quantidade);
+
+  /**
+   * @brief Remove até `quantidade` elementos publicando o novo início uma única vez
+   *
+   * @param saida Destino dos elementos removidos
+   * @param quantidade Número máximo de elementos a remover
+   * @return size_t Número de elementos efetivamente removidos
+   */
+  size_t pop_n(Type* saida, size_t quantidade);
+
+  /**
+   * @brief Retorna o número aproximado de elementos na fila
+   *
+   * O valor é exato apenas se nenhuma das threads estiver operando na fila.
+   *
+   * @return size_t
+   */
+  size_t size() const;
+
+  /**
+   * @brief Retorna se a fila está (aproximadamente) vazia
+   *
+   */
+  bool isEmpty() const;
+
+  /**
+   * @brief Retorna a capacidade da fila
+   *
+   * @return size_t
+   */
+  size_t capacity() const;
+
+ private:
+  template <typename Valor>
+  bool emplace(Valor&& dado);
+};
+
+template <typename Type>
+FilaSPSC<Type>::FilaSPSC(size_t capacidadeMinima)
+    : dados(nullptr), capacidade(1), mascara(0), inicio(0), fimCache(0), fim(0), inicioCache(0) {
+  if (capacidadeMinima == 0) {
+    throw std::invalid_argument("A capacidade da fila deve ser maior que 0");
+  }
+
+  while (capacidade < capacidadeMinima) {
+    capacidade <<= 1;
+  }
+  mascara = capacidade - 1;
+
+  dados = static_cast<Type*>(::operator new(sizeof(Type) * capacidade));
+}
+
+template <typename Type>
+FilaSPSC<Type>::~FilaSPSC() {
+  size_t atual = inicio.load(std::memory_order_relaxed);
+  size_t ultimo = fim.load(std::memory_order_relaxed);
+
+  for (; atual != ultimo; ++atual) {
+    dados[atual & mascara].~Type();
+  }
+
+  ::operator delete(dados);
+}
+
+template <typename Type>
+template <typename Valor>
+bool FilaSPSC<Type>::emplace(Valor&& dado) {
+  size_t posicao = fim.load(std::memory_order_relaxed);
+
+  // Só relê o início (escrito pelo consumidor) quando a cópia local indicar que a fila está cheia
+  if (posicao - inicioCache == capacidade) {
+    inicioCache = inicio.load(std::memory_order_acquire);
+    if (posicao - inicioCache == capacidade) {
+      return false;
+    }
+  }
+
+  new (dados + (posicao & mascara)) Type(std::forward<Valor>(dado));
+  fim.store(posicao + 1, std::memory_order_release);
+  return true;
+}
+
+template <typename Type>
+bool FilaSPSC<Type>::try_push(const Type& dado) {
+  return emplace(dado);
+}
+
+template <typename Type>
+bool FilaSPSC<Type>::try_push(Type&& dado) {
+  return emplace(std::move(dado));
+}
+
+template <typename Type>
+bool FilaSPSC<Type>::try_pop(Type& saida) {
+  size_t posicao = inicio.load(std::memory_order_relaxed);
+
+  // Só relê o fim (escrito pelo produtor) quando a cópia local indicar que a fila está vazia
+  if (posicao == fimCache) {
+    fimCache = fim.load(std::memory_order_acquire);
+    if (posicao == fimCache) {
+      return false;
+    }
+  }
+
+  Type* elemento = dados + (posicao & mascara);
+  saida = std::move(*elemento);
+  elemento->~Type();
+
+  inicio.store(posicao + 1, std::memory_order_release);
+  return true;
+}
+
+template <typename Type>
+size_t FilaSPSC<Type>::push_n(const Type* novos, size_t quantidade) {
+  size_t posicao = fim.load(std::memory_order_relaxed);
+
+  size_t livres = capacidade - (posicao - inicioCache);
+  if (livres < quantidade) {
+    inicioCache = inicio.load(std::memory_order_acquire);
+    livres = capacidade - (posicao - inicioCache);
+  }
+
+  if (quantidade > livres) {
+    quantidade = livres;
+  }
+
+  for (size_t i = 0; i < quantidade; ++i) {
+    new (dados + ((posicao + i) & mascara)) Type(novos[i]);
+  }
+
+  fim.store(posicao + quantidade, std::memory_order_release);
+  return quantidade;
+}
+
+template <typename Type>
+size_t FilaSPSC<Type>::pop_n(Type* saida, size_t quantidade) {
+  size_t posicao = inicio.load(std::memory_order_relaxed);
+
+  size_t disponiveis = fimCache - posicao;
+  if (disponiveis < quantidade) {
+    fimCache = fim.load(std::memory_order_acquire);
+    disponiveis = fimCache - posicao;
+  }
+
+  if (quantidade > disponiveis) {
+    quantidade = disponiveis;
+  }
+
+  for (size_t i = 0; i < quantidade; ++i) {
+    Type* elemento = dados + ((posicao + i) & mascara);
+    saida[i] = std::move(*elemento);
+    elemento->~Type();
+  }
+
+  inicio.store(posicao + quantidade, std::memory_order_release);
+  return quantidade;
+}
+
+template <typename Type>
+size_t FilaSPSC<Type>::size() const {
+  // O início é lido primeiro: como ele nunca ultrapassa o fim, a diferença nunca fica negativa
+  size_t primeiro = inicio.load(std::memory_order_acquire);
+  size_t ultimo = fim.load(std::memory_order_acquire);
+  return ultimo - primeiro;
+}
+
+template <typename Type>
+bool FilaSPSC<Type>::isEmpty() const {
+  return size() == 0;
+}
+
+template <typename Type>
+size_t FilaSPSC<Type>::capacity() const {
+  return capacidade;
+}
+
+#endif
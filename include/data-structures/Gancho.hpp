@@ -0,0 +1,67 @@
+#ifndef GANCHO_HPP
+#define GANCHO_HPP
+
+#include <cassert>
+
+/**
+ * @brief Gancho embutido nos objetos dos containers intrusivos
+ *
+ * Um objeto entra em um container intrusivo (`ListaIntrusiva`, `FilaIntrusiva`, `PilhaIntrusiva`)
+ * herdando um gancho: o container liga os ponteiros do próprio objeto, sem alocar nós nem copiar o
+ * objeto. A `Marca` distingue ganchos diferentes, então um mesmo objeto pode estar em vários
+ * containers ao mesmo tempo (um por gancho):
+ *
+ *     struct ListaPronta {};
+ *     struct Tarefa : Gancho<>, Gancho<ListaPronta> { ... };
+ *
+ *     FilaIntrusiva<Tarefa> fila;                  // usa Gancho<>
+ *     ListaIntrusiva<Tarefa, ListaPronta> prontas; // usa Gancho<ListaPronta>
+ *
+ * Todo gancho ligado tem `proximo` diferente de `nullptr` (os containers são circulares ou marcam
+ * o fim apontando o último gancho para ele mesmo), e os containers anulam os ponteiros ao desligar.
+ * Assim, sem `NDEBUG`, os containers verificam com `assert` que um objeto não é ligado duas vezes
+ * nem destruído enquanto ainda está ligado.
+ *
+ * O gancho não é copiado junto com o objeto: a cópia começa desligada.
+ *
+ * @tparam Marca Tipo usado apenas para distinguir ganchos do mesmo objeto
+ */
+template <typename Marca = void>
+class Gancho {
+ public:
+  Gancho() : anterior(nullptr), proximo(nullptr) {}
+  Gancho(const Gancho&) : Gancho() {}
+  Gancho& operator=(const Gancho&) { return *this; }
+
+  ~Gancho() { assert(!ligado() && "O objeto foi destruido enquanto ligado a um container"); }
+
+  /**
+   * @brief Retorna se o objeto está ligado a algum container por este gancho
+   *
+   */
+  bool ligado() const { return proximo != nullptr; }
+
+ private:
+  /**
+   * @brief Aponta para o gancho anterior (usado apenas pela `ListaIntrusiva`)
+   *
+   */
+  Gancho* anterior;
+
+  /**
+   * @brief Aponta para o próximo gancho
+   *
+   */
+  Gancho* proximo;
+
+  template <typename, typename>
+  friend class ListaIntrusiva;
+
+  template <typename, typename>
+  friend class FilaIntrusiva;
+
+  template <typename, typename>
+  friend class PilhaIntrusiva;
+};
+
+#endif
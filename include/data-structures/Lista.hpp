@@ -1,16 +1,26 @@
 #ifndef LISTA_HPP
 #define LISTA_HPP
 
+#include <cstddef>
+#include <exception>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+
+#include "../allocators/AlocadorMonotonico.hpp"
+
+// Usado apenas pela ordenação paralela; quem a chama inclui "algorithms/WorkStealingPool.hpp"
+class WorkStealingPool;
 
 /**
  * @brief Lista ligada simples
  *
  * @tparam Type
- *
- * @
+ * @tparam Allocator Alocador usado para os nós (por exemplo, `PoolAllocator` ou `ArenaAllocator`)
  */
-template <typename Type>
+template <typename Type, typename Allocator = std::allocator<Type>>
 class Lista {
  private:
   struct Node {
@@ -43,10 +53,72 @@ class Lista {
    */
   size_t tamanho;
 
+  using AlocadorNo = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using TraitsNo = std::allocator_traits<AlocadorNo>;
+
+  AlocadorNo alocador;
+
+  /**
+   * @brief Trechos com até esta quantidade de nós são ordenados por uma única tarefa no `sort`
+   * paralelo
+   *
+   */
+  static constexpr size_t GRAO_ORDENACAO = 1 << 14;
+
  public:
+  /**
+   * @brief Iterador (somente leitura) que percorre a lista do início ao fim
+   *
+   */
+  class const_iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Type*;
+    using reference = const Type&;
+
+    const_iterator() : node(nullptr) {}
+
+    reference operator*() const { return node->valor; }
+    pointer operator->() const { return &node->valor; }
+
+    const_iterator& operator++() {
+      node = node->proximo;
+      return *this;
+    }
+
+    const_iterator operator++(int) {
+      const_iterator anterior = *this;
+      node = node->proximo;
+      return anterior;
+    }
+
+    bool operator==(const const_iterator& outro) const { return node == outro.node; }
+    bool operator!=(const const_iterator& outro) const { return node != outro.node; }
+
+   private:
+    /**
+     * @brief Nó atual (`nullptr` representa o fim)
+     *
+     */
+    const Node* node;
+
+    explicit const_iterator(const Node* node) : node(node) {}
+
+    friend class Lista<Type, Allocator>;
+  };
+
+  using iterator = const_iterator;
+
   // Construtores (o construtor cópia é implementado mais abaixo)
-  Lista() : primeiro(nullptr), ultimo(nullptr), tamanho(0) {};
-  Lista(const Lista<Type>& outraLista);
+  Lista() : Lista(Allocator()) {}
+  explicit Lista(const Allocator& alocador)
+      : primeiro(nullptr), ultimo(nullptr), tamanho(0), alocador(alocador) {}
+  Lista(const Lista<Type, Allocator>& outraLista);
+  // Construtor de movimentação: toma os nós da outra lista, que fica vazia
+  Lista(Lista<Type, Allocator>&& outraLista) noexcept;
+  Lista<Type, Allocator>& operator=(const Lista<Type, Allocator>&) = delete;
   // Destrutor (implementado mais abaixo)
   ~Lista();
 
@@ -98,6 +170,62 @@ class Lista {
    */
   void remove(size_t posicao);
 
+  /**
+   * @brief Move todos os elementos de `outra` para antes da posição `posicao` desta lista
+   *
+   * Os nós são apenas religados, sem alocações nem cópias, e `outra` fica vazia. Custa
+   * O(posicao) para encontrar o ponto de inserção (O(1) no início e no final). As duas listas
+   * precisam ter alocadores iguais.
+   *
+   * @param posicao Índice desta lista onde o primeiro elemento movido ficará
+   * @param outra Lista de origem (diferente desta)
+   *
+   * @throw `std::out_of_range` se a posição for maior que o tamanho da lista
+   * @throw `std::invalid_argument` se `outra` for esta lista
+   */
+  void splice(size_t posicao, Lista<Type, Allocator>& outra);
+
+  /**
+   * @brief Move os elementos das posições [inicio, fim) de `outra` para antes da posição `posicao`
+   * desta lista
+   *
+   * Os nós são apenas religados, sem alocações nem cópias. Custa O(posicao) para encontrar o ponto
+   * de inserção e O(fim) para encontrar o trecho (O(inicio) se `fim` for o tamanho de `outra`).
+   * As duas listas precisam ter alocadores iguais.
+   *
+   * @param posicao Índice desta lista onde o primeiro elemento movido ficará
+   * @param outra Lista de origem (diferente desta)
+   * @param inicio Índice do primeiro elemento movido
+   * @param fim Índice seguinte ao último elemento movido
+   *
+   * @throw `std::out_of_range` se a posição for maior que o tamanho da lista, ou se o trecho não
+   * estiver dentro de `outra`
+   * @throw `std::invalid_argument` se `outra` for esta lista
+   */
+  void splice(size_t posicao, Lista<Type, Allocator>& outra, size_t inicio, size_t fim);
+
+  /**
+   * @brief Move todos os elementos de `outra` para o final desta lista, em O(1)
+   *
+   * As duas listas precisam ter alocadores iguais.
+   *
+   * @param outra Lista de origem, que fica vazia
+   */
+  void append(Lista<Type, Allocator>&& outra);
+
+  /**
+   * @brief Divide a lista na posição `posicao`
+   *
+   * Esta lista fica com os elementos [0, posicao) e os demais são movidos, sem alocações nem
+   * cópias, para a lista retornada. Custa O(posicao) para encontrar o ponto de divisão.
+   *
+   * @param posicao Índice do primeiro elemento da lista retornada
+   * @return Lista<Type, Allocator> Lista com os elementos [posicao, size())
+   *
+   * @throw `std::out_of_range` se a posição for maior que o tamanho da lista
+   */
+  Lista<Type, Allocator> split_at(size_t posicao);
+
   /**
    * @brief Limpa (reseta) completamente a lista
    *
@@ -110,28 +238,174 @@ class Lista {
    */
   void reverse();
 
+  /**
+   * @brief Ordena a lista em ordem crescente (com `operator<`), de forma estável
+   *
+   * Merge sort bottom-up em O(n log n) que apenas religa os ponteiros `proximo`: nenhum nó é
+   * alocado e nenhum elemento é copiado. Se a comparação lançar uma exceção, todos os elementos
+   * continuam na lista, em uma ordem não especificada.
+   */
+  void sort();
+
+  /**
+   * @brief Ordena a lista de acordo com `comp`, de forma estável
+   *
+   * @param comp Recebe dois `const Type&` e retorna se o primeiro vem antes do segundo
+   */
+  template <typename Compare>
+  void sort(Compare comp);
+
+  /**
+   * @brief Ordena a lista em paralelo, de forma estável
+   *
+   * A lista é dividida ao meio recursivamente até trechos de `GRAO_ORDENACAO` nós, que são
+   * ordenados por tarefas do `pool` e depois intercalados. A comparação é chamada por várias
+   * threads ao mesmo tempo.
+   *
+   * Este cabeçalho não inclui o pool (nem as dependências de threads dele): quem usa a ordenação
+   * paralela inclui "algorithms/WorkStealingPool.hpp".
+   */
+  void sort(WorkStealingPool& pool);
+
+  /**
+   * @brief Ordena a lista em paralelo, de forma estável, segundo `comp`
+   *
+   * @tparam Pool `WorkStealingPool` (ou outro pool com o mesmo `Grupo`)
+   */
+  template <typename Compare, typename Pool>
+  void sort(Compare comp, Pool& pool);
+
+  /**
+   * @brief Intercala os elementos de `outra` nesta lista, ambas já ordenadas (com `operator<`)
+   *
+   * Os nós de `outra` são religados nesta lista, em O(n + m) e sem alocações; `outra` fica vazia.
+   * Entre elementos equivalentes, os desta lista vêm antes. As duas listas precisam ter alocadores
+   * iguais.
+   *
+   * @param outra Lista ordenada cujos elementos serão movidos para esta
+   */
+  void merge(Lista<Type, Allocator>& outra);
+
+  template <typename Compare>
+  void merge(Lista<Type, Allocator>& outra, Compare comp);
+
+  /**
+   * @brief Remove os elementos iguais (com `operator==`) ao elemento anterior, mantendo apenas o
+   * primeiro de cada sequência
+   *
+   * Em uma lista ordenada, remove todos os elementos repetidos.
+   */
+  void unique();
+
   /**
    * @brief Imprime todos elementos da lista
    *
    */
   void print();
+
+  /**
+   * @brief Retorna o número de elementos da lista
+   *
+   * @return size_t
+   */
+  size_t size() const;
+
+  /**
+   * @brief Retorna quantos bytes os nós da lista ocupam
+   *
+   * Não inclui o espaço desperdiçado pelo alocador em cada alocação.
+   *
+   * @return size_t
+   */
+  size_t memoryUsage() const;
+
+  /**
+   * @brief Retorna um iterador para o primeiro elemento
+   *
+   */
+  const_iterator begin() const;
+
+  /**
+   * @brief Retorna o iterador que representa o fim da lista
+   *
+   */
+  const_iterator end() const;
+
+  /**
+   * @brief Retorna uma cópia do alocador da lista
+   *
+   * @return Allocator
+   */
+  Allocator get_allocator() const;
+
+ private:
+  Node* criarNo(const Type& valor);
+  void liberarNo(Node* node);
+
+  /**
+   * @brief Retorna o nó anterior à posição `posicao` (`nullptr` para a posição 0)
+   *
+   * Custa O(1) para a posição 0 e para a posição `tamanho` (o último nó).
+   */
+  Node* anteriorDe(size_t posicao) const;
+
+  /**
+   * @brief Atualiza `ultimo` percorrendo a lista a partir de `primeiro`
+   *
+   */
+  void atualizarUltimo();
+
+  /**
+   * @brief Liga a cadeia `segunda` ao final da cadeia `primeira` e retorna o início do resultado
+   *
+   */
+  static Node* concatenar(Node* primeira, Node* segunda);
+
+  /**
+   * @brief Intercala duas cadeias ordenadas (terminadas em `nullptr`) de forma estável
+   *
+   * Ao final, `primeira` recebe a cadeia intercalada e `segunda` fica vazia. Se `comp` lançar uma
+   * exceção, `primeira` recebe todos os nós das duas cadeias (fora de ordem) antes da exceção ser
+   * propagada.
+   */
+  template <typename Compare>
+  static void intercalar(Node*& primeira, Node*& segunda, Compare& comp);
+
+  /**
+   * @brief Ordena uma cadeia terminada em `nullptr` com merge sort bottom-up
+   *
+   * Cada nó entra como uma cadeia de tamanho 1 e é intercalado com as cadeias de tamanho 1, 2,
+   * 4, ... já formadas, como em um contador binário. Se `comp` lançar uma exceção, `cadeia` recebe
+   * todos os nós (fora de ordem) antes da exceção ser propagada.
+   */
+  template <typename Compare>
+  static void ordenarCadeia(Node*& cadeia, Compare& comp);
+
+  /**
+   * @brief Ordena uma cadeia com `quantidade` nós dividindo-a entre tarefas do `pool`
+   *
+   */
+  template <typename Compare, typename Pool>
+  static void ordenarParalelo(Node*& cadeia, size_t quantidade, Compare& comp, Pool& pool);
 };
 
-template <typename Type>
-Lista<Type>::Lista(const Lista<Type>& outraLista) : Lista() {
+template <typename Type, typename Allocator>
+Lista<Type, Allocator>::Lista(const Lista<Type, Allocator>& outraLista)
+    : Lista(std::allocator_traits<Allocator>::select_on_container_copy_construction(
+          outraLista.get_allocator())) {
   if (outraLista.primeiro == nullptr) {
     return;
   }
 
   // Criação do primeiro no da lista cópia
-  primeiro = new Node(outraLista.primeiro->valor);
+  primeiro = criarNo(outraLista.primeiro->valor);
 
   // Nós para percorrer as listas
   Node* atualCopia = primeiro;
   Node* atualOrig = outraLista.primeiro->proximo;
 
   while (atualOrig != nullptr) {
-    atualCopia->proximo = new Node<Type>(atualOrig->valor);
+    atualCopia->proximo = criarNo(atualOrig->valor);
     atualCopia = atualCopia->proximo;
     atualOrig = atualOrig->proximo;
   }
@@ -140,20 +414,31 @@ Lista<Type>::Lista(const Lista<Type>& outraLista) : Lista() {
   tamanho = outraLista.tamanho;
 }
 
-template <typename Type>
-Lista<Type>::~Lista() {
+template <typename Type, typename Allocator>
+Lista<Type, Allocator>::Lista(Lista<Type, Allocator>&& outraLista) noexcept
+    : primeiro(outraLista.primeiro),
+      ultimo(outraLista.ultimo),
+      tamanho(outraLista.tamanho),
+      alocador(outraLista.alocador) {
+  outraLista.primeiro = nullptr;
+  outraLista.ultimo = nullptr;
+  outraLista.tamanho = 0;
+}
+
+template <typename Type, typename Allocator>
+Lista<Type, Allocator>::~Lista() {
   clear();
 }
 
-template <typename Type>
-void Lista<Type>::pop_front() {
+template <typename Type, typename Allocator>
+void Lista<Type, Allocator>::pop_front() {
   if (tamanho == 0) {
     throw std::out_of_range("A lista esta vazia!");
   }
 
   Node* aux = primeiro;
   primeiro = primeiro->proximo;
-  delete aux;
+  liberarNo(aux);
 
   --tamanho;
 
@@ -162,14 +447,14 @@ void Lista<Type>::pop_front() {
   }
 }
 
-template <typename Type>
-void Lista<Type>::pop_back() {
+template <typename Type, typename Allocator>
+void Lista<Type, Allocator>::pop_back() {
   if (tamanho == 0) {
     throw std::out_of_range("A lista esta vazia!");
   }
 
   if (tamanho == 1) {
-    delete primeiro;
+    liberarNo(primeiro);
     primeiro = nullptr;
     ultimo = nullptr;
   } else {
@@ -180,7 +465,7 @@ void Lista<Type>::pop_back() {
     }
 
     // Remover o último nó
-    delete ultimo;
+    liberarNo(ultimo);
     penultimo->proximo = nullptr;
     ultimo = penultimo;
   }
@@ -188,10 +473,10 @@ void Lista<Type>::pop_back() {
   --tamanho;
 }
 
-template <typename Type>
-void Lista<Type>::push_front(Type dado) {
+template <typename Type, typename Allocator>
+void Lista<Type, Allocator>::push_front(Type dado) {
   // Criar um novo nó
-  Node* novo = new Node<Type>(dado);
+  Node* novo = criarNo(dado);
 
   // Se a lista estiver vazia
   if (tamanho == 0) {
@@ -206,10 +491,10 @@ void Lista<Type>::push_front(Type dado) {
   ++tamanho;
 }
 
-template <typename Type>
-void Lista<Type>::push_back(Type dado) {
+template <typename Type, typename Allocator>
+void Lista<Type, Allocator>::push_back(Type dado) {
   // Cria um novo nó
-  Node* novo = new Node(dado);
+  Node* novo = criarNo(dado);
 
   // Se a lista estiver vazia
   if (tamanho == 0) {
@@ -224,8 +509,8 @@ void Lista<Type>::push_back(Type dado) {
   ++tamanho;
 }
 
-template <typename Type>
-void Lista<Type>::insert(Type dado, size_t posicao) {
+template <typename Type, typename Allocator>
+void Lista<Type, Allocator>::insert(Type dado, size_t posicao) {
   if (posicao < 0 || posicao > tamanho) {
     throw std::out_of_range("Posicao invalida (maior que o tamanho da lista)");
   }
@@ -249,7 +534,7 @@ void Lista<Type>::insert(Type dado, size_t posicao) {
   }
 
   // Cria um novo nó
-  Node* novo = new Node(dado);
+  Node* novo = criarNo(dado);
 
   // O novo nó deve ficar entre o nó temp e o nó depois de temp
   novo->proximo = temp->proximo;
@@ -258,8 +543,8 @@ void Lista<Type>::insert(Type dado, size_t posicao) {
   ++tamanho;
 }
 
-template <typename Type>
-void Lista<Type>::remove(size_t posicao) {
+template <typename Type, typename Allocator>
+void Lista<Type, Allocator>::remove(size_t posicao) {
   if (posicao >= tamanho) {
     throw std::out_of_range("Posicao invalida (maior ou igual ao tamanho da lista)");
   }
@@ -287,19 +572,98 @@ void Lista<Type>::remove(size_t posicao) {
     ultimo = temp;
   }
 
-  delete deletar;
+  liberarNo(deletar);
 
   --tamanho;
 }
 
-template <typename Type>
-void Lista<Type>::clear() {
-  Node* atual = primeiro;
+template <typename Type, typename Allocator>
+void Lista<Type, Allocator>::splice(size_t posicao, Lista<Type, Allocator>& outra) {
+  splice(posicao, outra, 0, outra.tamanho);
+}
 
-  while (atual != nullptr) {
-    Node* posterior = atual->proximo;
-    delete atual;
-    atual = posterior;
+template <typename Type, typename Allocator>
+void Lista<Type, Allocator>::splice(size_t posicao, Lista<Type, Allocator>& outra, size_t inicio,
+                                    size_t fim) {
+  if (&outra == this) {
+    throw std::invalid_argument("A lista de origem deve ser diferente da lista de destino");
+  }
+
+  if (posicao > tamanho) {
+    throw std::out_of_range("Posicao invalida (maior que o tamanho da lista)");
+  }
+
+  if (inicio > fim || fim > outra.tamanho) {
+    throw std::out_of_range("Trecho invalido (fora da lista de origem)");
+  }
+
+  size_t quantidade = fim - inicio;
+  if (quantidade == 0) return;
+
+  // Encontra o trecho [primeiroMovido, ultimoMovido] na outra lista
+  Node* antesOrigem = outra.anteriorDe(inicio);
+  Node* primeiroMovido = antesOrigem != nullptr ? antesOrigem->proximo : outra.primeiro;
+  Node* ultimoMovido = outra.anteriorDe(fim);
+
+  // Desliga o trecho da outra lista
+  if (antesOrigem != nullptr) {
+    antesOrigem->proximo = ultimoMovido->proximo;
+  } else {
+    outra.primeiro = ultimoMovido->proximo;
+  }
+
+  if (ultimoMovido == outra.ultimo) {
+    outra.ultimo = antesOrigem;
+  }
+
+  outra.tamanho -= quantidade;
+
+  // Liga o trecho antes da posição desejada desta lista
+  Node* antesDestino = anteriorDe(posicao);
+  if (antesDestino != nullptr) {
+    ultimoMovido->proximo = antesDestino->proximo;
+    antesDestino->proximo = primeiroMovido;
+  } else {
+    ultimoMovido->proximo = primeiro;
+    primeiro = primeiroMovido;
+  }
+
+  if (ultimoMovido->proximo == nullptr) {
+    ultimo = ultimoMovido;
+  }
+
+  tamanho += quantidade;
+}
+
+template <typename Type, typename Allocator>
+void Lista<Type, Allocator>::append(Lista<Type, Allocator>&& outra) {
+  splice(tamanho, outra);
+}
+
+template <typename Type, typename Allocator>
+Lista<Type, Allocator> Lista<Type, Allocator>::split_at(size_t posicao) {
+  if (posicao > tamanho) {
+    throw std::out_of_range("Posicao invalida (maior que o tamanho da lista)");
+  }
+
+  // A lista nova usa o mesmo alocador, que vai liberar os nós movidos
+  Lista<Type, Allocator> resto(get_allocator());
+  resto.splice(0, *this, posicao, tamanho);
+
+  return resto;
+}
+
+template <typename Type, typename Allocator>
+void Lista<Type, Allocator>::clear() {
+  // Com uma arena e valores de destrutor trivial, os nós são abandonados sem serem percorridos
+  if (!DescarteSemPercurso<Allocator, Type>::value) {
+    Node* atual = primeiro;
+
+    while (atual != nullptr) {
+      Node* posterior = atual->proximo;
+      liberarNo(atual);
+      atual = posterior;
+    }
   }
 
   primeiro = nullptr;
@@ -307,8 +671,8 @@ void Lista<Type>::clear() {
   tamanho = 0;
 }
 
-template <typename Type>
-void Lista<Type>::reverse() {
+template <typename Type, typename Allocator>
+void Lista<Type, Allocator>::reverse() {
   // Criação dos nós anterior, atual e posterior, nós auxiliares para inverter a
   // lista
   Node* anterior = nullptr;
@@ -333,8 +697,101 @@ void Lista<Type>::reverse() {
   }
 }
 
-template <typename Type>
-void Lista<Type>::print() {
+template <typename Type, typename Allocator>
+void Lista<Type, Allocator>::sort() {
+  sort(std::less<Type>());
+}
+
+template <typename Type, typename Allocator>
+template <typename Compare>
+void Lista<Type, Allocator>::sort(Compare comp) {
+  if (tamanho < 2) return;
+
+  try {
+    ordenarCadeia(primeiro, comp);
+  } catch (...) {
+    atualizarUltimo();
+    throw;
+  }
+
+  atualizarUltimo();
+}
+
+template <typename Type, typename Allocator>
+void Lista<Type, Allocator>::sort(WorkStealingPool& pool) {
+  sort(std::less<Type>(), pool);
+}
+
+template <typename Type, typename Allocator>
+template <typename Compare, typename Pool>
+void Lista<Type, Allocator>::sort(Compare comp, Pool& pool) {
+  if (tamanho < 2) return;
+
+  try {
+    ordenarParalelo(primeiro, tamanho, comp, pool);
+  } catch (...) {
+    atualizarUltimo();
+    throw;
+  }
+
+  atualizarUltimo();
+}
+
+template <typename Type, typename Allocator>
+void Lista<Type, Allocator>::merge(Lista<Type, Allocator>& outra) {
+  merge(outra, std::less<Type>());
+}
+
+template <typename Type, typename Allocator>
+template <typename Compare>
+void Lista<Type, Allocator>::merge(Lista<Type, Allocator>& outra, Compare comp) {
+  if (&outra == this || outra.tamanho == 0) return;
+
+  // O último da intercalação é o último desta lista só se ele for maior que o último da outra
+  Node* novoUltimo =
+      tamanho > 0 && comp(outra.ultimo->valor, ultimo->valor) ? ultimo : outra.ultimo;
+
+  Node* segunda = outra.primeiro;
+  size_t total = tamanho + outra.tamanho;
+
+  outra.primeiro = nullptr;
+  outra.ultimo = nullptr;
+  outra.tamanho = 0;
+  tamanho = total;
+
+  try {
+    intercalar(primeiro, segunda, comp);
+  } catch (...) {
+    atualizarUltimo();
+    throw;
+  }
+
+  ultimo = novoUltimo;
+}
+
+template <typename Type, typename Allocator>
+void Lista<Type, Allocator>::unique() {
+  if (tamanho < 2) return;
+
+  Node* atual = primeiro;
+
+  // Remove o sucessor enquanto ele for igual ao nó atual
+  while (atual->proximo != nullptr) {
+    if (atual->proximo->valor == atual->valor) {
+      Node* repetido = atual->proximo;
+      atual->proximo = repetido->proximo;
+      liberarNo(repetido);
+      --tamanho;
+    } else {
+      atual = atual->proximo;
+    }
+  }
+
+  ultimo = atual;
+}
+
+template <typename Type, typename Allocator>
+void Lista<Type, Allocator>::print() {
   Node* temp = primeiro;
 
   if (!temp) {
@@ -351,4 +808,208 @@ void Lista<Type>::print() {
   std::cout << std::endl;
 }
 
+template <typename Type, typename Allocator>
+size_t Lista<Type, Allocator>::size() const {
+  return tamanho;
+}
+
+template <typename Type, typename Allocator>
+size_t Lista<Type, Allocator>::memoryUsage() const {
+  return tamanho * sizeof(Node);
+}
+
+template <typename Type, typename Allocator>
+typename Lista<Type, Allocator>::const_iterator Lista<Type, Allocator>::begin() const {
+  return const_iterator(primeiro);
+}
+
+template <typename Type, typename Allocator>
+typename Lista<Type, Allocator>::const_iterator Lista<Type, Allocator>::end() const {
+  return const_iterator(nullptr);
+}
+
+template <typename Type, typename Allocator>
+Allocator Lista<Type, Allocator>::get_allocator() const {
+  return Allocator(alocador);
+}
+
+template <typename Type, typename Allocator>
+typename Lista<Type, Allocator>::Node* Lista<Type, Allocator>::criarNo(const Type& valor) {
+  Node* node = TraitsNo::allocate(alocador, 1);
+  try {
+    TraitsNo::construct(alocador, node, valor);
+  } catch (...) {
+    TraitsNo::deallocate(alocador, node, 1);
+    throw;
+  }
+  return node;
+}
+
+template <typename Type, typename Allocator>
+void Lista<Type, Allocator>::liberarNo(typename Lista<Type, Allocator>::Node* node) {
+  TraitsNo::destroy(alocador, node);
+  TraitsNo::deallocate(alocador, node, 1);
+}
+
+template <typename Type, typename Allocator>
+typename Lista<Type, Allocator>::Node* Lista<Type, Allocator>::anteriorDe(size_t posicao) const {
+  if (posicao == 0) return nullptr;
+  if (posicao == tamanho) return ultimo;
+
+  Node* anterior = primeiro;
+  for (size_t i = 0; i < posicao - 1; ++i) {
+    anterior = anterior->proximo;
+  }
+
+  return anterior;
+}
+
+template <typename Type, typename Allocator>
+void Lista<Type, Allocator>::atualizarUltimo() {
+  ultimo = primeiro;
+  while (ultimo != nullptr && ultimo->proximo != nullptr) {
+    ultimo = ultimo->proximo;
+  }
+}
+
+template <typename Type, typename Allocator>
+typename Lista<Type, Allocator>::Node* Lista<Type, Allocator>::concatenar(
+    typename Lista<Type, Allocator>::Node* primeira,
+    typename Lista<Type, Allocator>::Node* segunda) {
+  if (primeira == nullptr) return segunda;
+
+  Node* fim = primeira;
+  while (fim->proximo != nullptr) fim = fim->proximo;
+  fim->proximo = segunda;
+
+  return primeira;
+}
+
+template <typename Type, typename Allocator>
+template <typename Compare>
+void Lista<Type, Allocator>::intercalar(typename Lista<Type, Allocator>::Node*& primeira,
+                                        typename Lista<Type, Allocator>::Node*& segunda,
+                                        Compare& comp) {
+  Node* resultado = nullptr;
+  Node** cauda = &resultado;
+
+  try {
+    while (primeira != nullptr && segunda != nullptr) {
+      // Só pega da segunda cadeia se for estritamente menor, o que mantém a ordenação estável
+      if (comp(segunda->valor, primeira->valor)) {
+        *cauda = segunda;
+        segunda = segunda->proximo;
+      } else {
+        *cauda = primeira;
+        primeira = primeira->proximo;
+      }
+      cauda = &(*cauda)->proximo;
+    }
+  } catch (...) {
+    *cauda = concatenar(primeira, segunda);
+    primeira = resultado;
+    segunda = nullptr;
+    throw;
+  }
+
+  // O que sobrou de uma das cadeias já está ordenado e vai inteiro para o final
+  *cauda = primeira != nullptr ? primeira : segunda;
+  primeira = resultado;
+  segunda = nullptr;
+}
+
+template <typename Type, typename Allocator>
+template <typename Compare>
+void Lista<Type, Allocator>::ordenarCadeia(typename Lista<Type, Allocator>::Node*& cadeia,
+                                           Compare& comp) {
+  // niveis[i] é vazio ou uma cadeia ordenada de 2^i nós; os níveis mais altos têm os nós que
+  // vieram antes, então entram como primeira cadeia nas intercalações
+  Node* niveis[64] = {};
+  Node* restante = cadeia;
+
+  try {
+    while (restante != nullptr) {
+      Node* carga = restante;
+      restante = restante->proximo;
+      carga->proximo = nullptr;
+
+      size_t nivel = 0;
+      for (; niveis[nivel] != nullptr; ++nivel) {
+        intercalar(niveis[nivel], carga, comp);
+        carga = niveis[nivel];
+        niveis[nivel] = nullptr;
+      }
+      niveis[nivel] = carga;
+    }
+
+    Node* resultado = nullptr;
+    for (Node*& nivel : niveis) {
+      if (nivel != nullptr) {
+        intercalar(nivel, resultado, comp);
+        resultado = nivel;
+        nivel = nullptr;
+      }
+    }
+
+    cadeia = resultado;
+  } catch (...) {
+    // Junta os nós de todos os níveis e os que ainda não foram ordenados
+    cadeia = restante;
+    for (Node* nivel : niveis) cadeia = concatenar(nivel, cadeia);
+    throw;
+  }
+}
+
+template <typename Type, typename Allocator>
+template <typename Compare, typename Pool>
+void Lista<Type, Allocator>::ordenarParalelo(typename Lista<Type, Allocator>::Node*& cadeia,
+                                             size_t quantidade, Compare& comp, Pool& pool) {
+  if (quantidade <= GRAO_ORDENACAO) {
+    ordenarCadeia(cadeia, comp);
+    return;
+  }
+
+  // Divide a cadeia ao meio
+  size_t metade = quantidade / 2;
+  Node* esquerda = cadeia;
+  Node* fimEsquerda = esquerda;
+  for (size_t i = 1; i < metade; ++i) fimEsquerda = fimEsquerda->proximo;
+  Node* direita = fimEsquerda->proximo;
+  fimEsquerda->proximo = nullptr;
+
+  // As exceções são guardadas para que as duas metades voltem a formar uma cadeia antes de serem
+  // propagadas
+  std::exception_ptr erroEsquerda;
+  std::exception_ptr erroDireita;
+
+  typename Pool::Grupo grupo(pool);
+  try {
+    grupo.executar([&] {
+      try {
+        ordenarParalelo(esquerda, metade, comp, pool);
+      } catch (...) {
+        erroEsquerda = std::current_exception();
+      }
+    });
+  } catch (...) {
+    fimEsquerda->proximo = direita;
+    throw;
+  }
+
+  try {
+    ordenarParalelo(direita, quantidade - metade, comp, pool);
+  } catch (...) {
+    erroDireita = std::current_exception();
+  }
+  grupo.aguardar();
+
+  if (erroEsquerda || erroDireita) {
+    cadeia = concatenar(esquerda, direita);
+    std::rethrow_exception(erroEsquerda ? erroEsquerda : erroDireita);
+  }
+
+  cadeia = esquerda;
+  intercalar(cadeia, direita, comp);
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,658 @@
+#ifndef LISTA_DESENROLADA_HPP
+#define LISTA_DESENROLADA_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "../allocators/AlocadorMonotonico.hpp"
+
+/**
+ * @brief Lista ligada desenrolada: cada nó guarda até `ElementosPorNo` elementos contíguos
+ *
+ * Tem a mesma interface da `Lista`, mas percorrer a lista custa uma falta de cache a cada
+ * `ElementosPorNo` elementos em vez de uma por elemento, e os ponteiros de encadeamento são
+ * divididos entre os elementos do nó.
+ *
+ * Um `insert` em um nó cheio divide o nó ao meio. Um `remove` que deixa o nó com menos da metade
+ * da capacidade pega elementos do próximo nó, ou junta os dois quando eles cabem em um só. Assim
+ * os nós (exceto o último) ficam pelo menos meio cheios.
+ *
+ * @tparam Type
+ * @tparam ElementosPorNo Capacidade de cada nó (padrão: cerca de 256 bytes de elementos)
+ * @tparam Allocator Alocador usado para os nós
+ */
+template <typename Type, size_t ElementosPorNo = (sizeof(Type) <= 32 ? 256 / sizeof(Type) : 8),
+          typename Allocator = std::allocator<Type>>
+class ListaDesenrolada {
+  static_assert(ElementosPorNo >= 2, "O nó precisa ter pelo menos dois elementos");
+
+ private:
+  struct Node {
+    Node* anterior;
+    Node* proximo;
+
+    /**
+     * @brief Quantidade de elementos do nó (sempre nas primeiras posições de `dados`)
+     *
+     */
+    size_t quantidade;
+
+    /**
+     * @brief Memória (não inicializada além de `quantidade`) dos elementos do nó
+     *
+     */
+    alignas(Type) unsigned char dados[sizeof(Type) * ElementosPorNo];
+
+    Node() : anterior(nullptr), proximo(nullptr), quantidade(0) {}
+
+    Type* valores() { return reinterpret_cast<Type*>(dados); }
+    const Type* valores() const { return reinterpret_cast<const Type*>(dados); }
+  };
+
+  /**
+   * @brief Quantidade mínima de elementos nos nós que não são o último
+   *
+   */
+  static constexpr size_t MINIMO_POR_NO = ElementosPorNo / 2;
+
+  using AlocadorNo = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using TraitsNo = std::allocator_traits<AlocadorNo>;
+
+  Node* primeiro;
+  Node* ultimo;
+
+  /**
+   * @brief Número de elementos na lista
+   *
+   */
+  size_t tamanho;
+
+  /**
+   * @brief Número de nós na lista
+   *
+   */
+  size_t quantidadeNos;
+
+  AlocadorNo alocador;
+
+ public:
+  /**
+   * @brief Iterador (somente leitura) que percorre a lista do início ao fim
+   *
+   */
+  class const_iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Type*;
+    using reference = const Type&;
+
+    const_iterator() : node(nullptr), indice(0) {}
+
+    reference operator*() const { return node->valores()[indice]; }
+    pointer operator->() const { return node->valores() + indice; }
+
+    const_iterator& operator++() {
+      if (++indice == node->quantidade) {
+        node = node->proximo;
+        indice = 0;
+      }
+      return *this;
+    }
+
+    const_iterator operator++(int) {
+      const_iterator anterior = *this;
+      ++*this;
+      return anterior;
+    }
+
+    bool operator==(const const_iterator& outro) const {
+      return node == outro.node && indice == outro.indice;
+    }
+    bool operator!=(const const_iterator& outro) const { return !(*this == outro); }
+
+   private:
+    /**
+     * @brief Nó atual (`nullptr` representa o fim)
+     *
+     */
+    const Node* node;
+    size_t indice;
+
+    const_iterator(const Node* node, size_t indice) : node(node), indice(indice) {}
+
+    friend class ListaDesenrolada<Type, ElementosPorNo, Allocator>;
+  };
+
+  using iterator = const_iterator;
+
+  // Construtores (o construtor cópia é implementado mais abaixo)
+  ListaDesenrolada() : ListaDesenrolada(Allocator()) {}
+  explicit ListaDesenrolada(const Allocator& alocador)
+      : primeiro(nullptr), ultimo(nullptr), tamanho(0), quantidadeNos(0), alocador(alocador) {}
+  ListaDesenrolada(const ListaDesenrolada<Type, ElementosPorNo, Allocator>& outraLista);
+  ListaDesenrolada<Type, ElementosPorNo, Allocator>& operator=(
+      const ListaDesenrolada<Type, ElementosPorNo, Allocator>&) = delete;
+  // Destrutor (implementado mais abaixo)
+  ~ListaDesenrolada();
+
+  /**
+   * @brief Remove o primeiro elemento da lista
+   *
+   * @throw `std::out_of_range` se a lista estiver vazia
+   */
+  void pop_front();
+
+  /**
+   * @brief Remove o último elemento da lista
+   *
+   * @throw `std::out_of_range` se a lista estiver vazia
+   */
+  void pop_back();
+
+  /**
+   * @brief Adiciona um novo elemento no início da lista
+   *
+   * @param dado Novo dado que será adicionado na lista
+   */
+  void push_front(Type dado);
+
+  /**
+   * @brief Adiciona um novo elemento no final da lista
+   *
+   * @param dado Novo dado que será adicionado na lista
+   */
+  void push_back(Type dado);
+
+  /**
+   * @brief Adiciona um novo elemento em uma dada posição da lista
+   *
+   * A busca pela posição pula um nó inteiro por vez.
+   *
+   * @param dado Novo dado que será adicionado na lista
+   * @param posicao Índice da lista onde será adicionado um novo elemento
+   *
+   * @throw `std::out_of_range` se a posição for maior que o tamanho da lista
+   */
+  void insert(Type dado, size_t posicao);
+
+  /**
+   * @brief Remove um elemento em uma dada posição da lista
+   *
+   * @param posicao Índice da lista que será removido
+   *
+   * @throw `std::out_of_range` se a posição for maior ou igual ao tamanho da
+   * lista
+   */
+  void remove(size_t posicao);
+
+  /**
+   * @brief Limpa (reseta) completamente a lista
+   *
+   */
+  void clear();
+
+  /**
+   * @brief Inverte todos elementos da lista
+   *
+   * Inverte a ordem dos nós e, dentro de cada nó, a ordem dos elementos.
+   */
+  void reverse();
+
+  /**
+   * @brief Imprime todos elementos da lista
+   *
+   */
+  void print();
+
+  /**
+   * @brief Retorna o número de elementos da lista
+   *
+   * @return size_t
+   */
+  size_t size() const;
+
+  /**
+   * @brief Retorna quantos bytes os nós da lista ocupam
+   *
+   * Não inclui o espaço desperdiçado pelo alocador em cada alocação.
+   *
+   * @return size_t
+   */
+  size_t memoryUsage() const;
+
+  /**
+   * @brief Retorna um iterador para o primeiro elemento
+   *
+   */
+  const_iterator begin() const;
+
+  /**
+   * @brief Retorna o iterador que representa o fim da lista
+   *
+   */
+  const_iterator end() const;
+
+  /**
+   * @brief Retorna uma cópia do alocador da lista
+   *
+   * @return Allocator
+   */
+  Allocator get_allocator() const;
+
+ private:
+  /**
+   * @brief Cria um nó vazio e o encadeia logo depois de `anterior` (no início, se for `nullptr`)
+   *
+   */
+  Node* criarNo(Node* anterior);
+
+  /**
+   * @brief Desencadeia e desaloca um nó (os elementos já devem ter sido destruídos)
+   *
+   */
+  void liberarNo(Node* node);
+
+  /**
+   * @brief Encontra o nó que contém a posição e o índice dela dentro do nó
+   *
+   * @param posicao Posição na lista, menor que o tamanho
+   * @param indice Recebe o índice da posição dentro do nó retornado
+   */
+  Node* localizar(size_t posicao, size_t& indice) const;
+
+  /**
+   * @brief Insere um valor na posição `indice` de um nó, dividindo o nó se ele estiver cheio
+   *
+   */
+  void inserirEm(Node* node, size_t indice, Type&& valor);
+
+  /**
+   * @brief Insere um valor na posição `indice` de um nó que não está cheio
+   *
+   */
+  static void inserirNoNo(Node* node, size_t indice, Type&& valor);
+
+  /**
+   * @brief Remove o valor da posição `indice` de um nó, deslocando os seguintes
+   *
+   */
+  static void removerDoNo(Node* node, size_t indice);
+
+  /**
+   * @brief Move os elementos a partir de `inicio` de `origem` para o fim de `destino`
+   *
+   */
+  static void moverElementos(Node* origem, size_t inicio, Node* destino);
+
+  /**
+   * @brief Restaura a ocupação mínima de um nó depois de uma remoção
+   *
+   * Remove o nó se ele ficou vazio. Se ficou com menos que `MINIMO_POR_NO` elementos, junta com o
+   * próximo nó quando os dois cabem em um só, ou então pega elementos do início do próximo.
+   */
+  void rebalancear(Node* node);
+};
+
+template <typename Type, size_t ElementosPorNo, typename Allocator>
+ListaDesenrolada<Type, ElementosPorNo, Allocator>::ListaDesenrolada(
+    const ListaDesenrolada<Type, ElementosPorNo, Allocator>& outraLista)
+    : ListaDesenrolada(std::allocator_traits<Allocator>::select_on_container_copy_construction(
+          outraLista.get_allocator())) {
+  // Copia nó por nó, mantendo a mesma ocupação da lista original
+  for (const Node* original = outraLista.primeiro; original != nullptr;
+       original = original->proximo) {
+    Node* copia = criarNo(ultimo);
+    for (size_t i = 0; i < original->quantidade; ++i) {
+      new (copia->valores() + i) Type(original->valores()[i]);
+      ++copia->quantidade;
+      ++tamanho;
+    }
+  }
+}
+
+template <typename Type, size_t ElementosPorNo, typename Allocator>
+ListaDesenrolada<Type, ElementosPorNo, Allocator>::~ListaDesenrolada() {
+  clear();
+}
+
+template <typename Type, size_t ElementosPorNo, typename Allocator>
+typename ListaDesenrolada<Type, ElementosPorNo, Allocator>::Node*
+ListaDesenrolada<Type, ElementosPorNo, Allocator>::criarNo(
+    typename ListaDesenrolada<Type, ElementosPorNo, Allocator>::Node* anterior) {
+  Node* node = TraitsNo::allocate(alocador, 1);
+  TraitsNo::construct(alocador, node);
+
+  Node* posterior = anterior == nullptr ? primeiro : anterior->proximo;
+  node->anterior = anterior;
+  node->proximo = posterior;
+
+  if (anterior == nullptr) {
+    primeiro = node;
+  } else {
+    anterior->proximo = node;
+  }
+
+  if (posterior == nullptr) {
+    ultimo = node;
+  } else {
+    posterior->anterior = node;
+  }
+
+  ++quantidadeNos;
+  return node;
+}
+
+template <typename Type, size_t ElementosPorNo, typename Allocator>
+void ListaDesenrolada<Type, ElementosPorNo, Allocator>::liberarNo(
+    typename ListaDesenrolada<Type, ElementosPorNo, Allocator>::Node* node) {
+  if (node->anterior == nullptr) {
+    primeiro = node->proximo;
+  } else {
+    node->anterior->proximo = node->proximo;
+  }
+
+  if (node->proximo == nullptr) {
+    ultimo = node->anterior;
+  } else {
+    node->proximo->anterior = node->anterior;
+  }
+
+  --quantidadeNos;
+  TraitsNo::destroy(alocador, node);
+  TraitsNo::deallocate(alocador, node, 1);
+}
+
+template <typename Type, size_t ElementosPorNo, typename Allocator>
+typename ListaDesenrolada<Type, ElementosPorNo, Allocator>::Node*
+ListaDesenrolada<Type, ElementosPorNo, Allocator>::localizar(size_t posicao, size_t& indice) const {
+  // Vem pelo lado mais próximo da posição, pulando nós inteiros
+  if (posicao < tamanho / 2) {
+    Node* node = primeiro;
+    while (posicao >= node->quantidade) {
+      posicao -= node->quantidade;
+      node = node->proximo;
+    }
+
+    indice = posicao;
+    return node;
+  }
+
+  size_t restantes = tamanho - posicao;
+  Node* node = ultimo;
+  while (restantes > node->quantidade) {
+    restantes -= node->quantidade;
+    node = node->anterior;
+  }
+
+  indice = node->quantidade - restantes;
+  return node;
+}
+
+template <typename Type, size_t ElementosPorNo, typename Allocator>
+void ListaDesenrolada<Type, ElementosPorNo, Allocator>::inserirEm(
+    typename ListaDesenrolada<Type, ElementosPorNo, Allocator>::Node* node, size_t indice,
+    Type&& valor) {
+  if (node->quantidade == ElementosPorNo) {
+    // Nó cheio: a metade superior vai para um novo nó logo depois dele
+    Node* novo = criarNo(node);
+    moverElementos(node, ElementosPorNo / 2, novo);
+
+    if (indice > node->quantidade) {
+      indice -= node->quantidade;
+      node = novo;
+    }
+  }
+
+  inserirNoNo(node, indice, std::move(valor));
+  ++tamanho;
+}
+
+template <typename Type, size_t ElementosPorNo, typename Allocator>
+void ListaDesenrolada<Type, ElementosPorNo, Allocator>::inserirNoNo(
+    typename ListaDesenrolada<Type, ElementosPorNo, Allocator>::Node* node, size_t indice,
+    Type&& valor) {
+  Type* valores = node->valores();
+
+  if (indice == node->quantidade) {
+    new (valores + indice) Type(std::move(valor));
+  } else {
+    // O último elemento vai para a posição não inicializada; os demais são deslocados
+    new (valores + node->quantidade) Type(std::move(valores[node->quantidade - 1]));
+    std::move_backward(valores + indice, valores + node->quantidade - 1,
+                       valores + node->quantidade);
+    valores[indice] = std::move(valor);
+  }
+
+  ++node->quantidade;
+}
+
+template <typename Type, size_t ElementosPorNo, typename Allocator>
+void ListaDesenrolada<Type, ElementosPorNo, Allocator>::removerDoNo(
+    typename ListaDesenrolada<Type, ElementosPorNo, Allocator>::Node* node, size_t indice) {
+  Type* valores = node->valores();
+
+  std::move(valores + indice + 1, valores + node->quantidade, valores + indice);
+  valores[node->quantidade - 1].~Type();
+  --node->quantidade;
+}
+
+template <typename Type, size_t ElementosPorNo, typename Allocator>
+void ListaDesenrolada<Type, ElementosPorNo, Allocator>::moverElementos(
+    typename ListaDesenrolada<Type, ElementosPorNo, Allocator>::Node* origem, size_t inicio,
+    typename ListaDesenrolada<Type, ElementosPorNo, Allocator>::Node* destino) {
+  Type* valores = origem->valores();
+
+  for (size_t i = inicio; i < origem->quantidade; ++i) {
+    new (destino->valores() + destino->quantidade) Type(std::move(valores[i]));
+    ++destino->quantidade;
+    valores[i].~Type();
+  }
+
+  origem->quantidade = inicio;
+}
+
+template <typename Type, size_t ElementosPorNo, typename Allocator>
+void ListaDesenrolada<Type, ElementosPorNo, Allocator>::rebalancear(
+    typename ListaDesenrolada<Type, ElementosPorNo, Allocator>::Node* node) {
+  if (node->quantidade == 0) {
+    liberarNo(node);
+    return;
+  }
+
+  Node* proximo = node->proximo;
+  if (node->quantidade >= MINIMO_POR_NO || proximo == nullptr) return;
+
+  if (node->quantidade + proximo->quantidade <= ElementosPorNo) {
+    // Os dois cabem em um nó: o próximo é absorvido
+    moverElementos(proximo, 0, node);
+    liberarNo(proximo);
+    return;
+  }
+
+  // Pega do início do próximo o suficiente para voltar à ocupação mínima. O próximo tem mais que
+  // `ElementosPorNo - MINIMO_POR_NO` elementos, então também continua acima do mínimo
+  size_t faltam = MINIMO_POR_NO - node->quantidade;
+  Type* valores = proximo->valores();
+
+  for (size_t i = 0; i < faltam; ++i) {
+    new (node->valores() + node->quantidade) Type(std::move(valores[i]));
+    ++node->quantidade;
+  }
+
+  std::move(valores + faltam, valores + proximo->quantidade, valores);
+  for (size_t i = proximo->quantidade - faltam; i < proximo->quantidade; ++i) valores[i].~Type();
+  proximo->quantidade -= faltam;
+}
+
+template <typename Type, size_t ElementosPorNo, typename Allocator>
+void ListaDesenrolada<Type, ElementosPorNo, Allocator>::pop_front() {
+  if (tamanho == 0) {
+    throw std::out_of_range("A lista esta vazia!");
+  }
+
+  removerDoNo(primeiro, 0);
+  --tamanho;
+  rebalancear(primeiro);
+}
+
+template <typename Type, size_t ElementosPorNo, typename Allocator>
+void ListaDesenrolada<Type, ElementosPorNo, Allocator>::pop_back() {
+  if (tamanho == 0) {
+    throw std::out_of_range("A lista esta vazia!");
+  }
+
+  // O último nó não tem ocupação mínima: ele só é removido quando esvazia
+  ultimo->valores()[ultimo->quantidade - 1].~Type();
+  --ultimo->quantidade;
+  --tamanho;
+
+  if (ultimo->quantidade == 0) liberarNo(ultimo);
+}
+
+template <typename Type, size_t ElementosPorNo, typename Allocator>
+void ListaDesenrolada<Type, ElementosPorNo, Allocator>::push_front(Type dado) {
+  if (primeiro == nullptr) {
+    push_back(std::move(dado));
+    return;
+  }
+
+  // Um novo nó no início ficaria com um único elemento, então o primeiro nó é dividido
+  inserirEm(primeiro, 0, std::move(dado));
+}
+
+template <typename Type, size_t ElementosPorNo, typename Allocator>
+void ListaDesenrolada<Type, ElementosPorNo, Allocator>::push_back(Type dado) {
+  if (ultimo == nullptr || ultimo->quantidade == ElementosPorNo) {
+    criarNo(ultimo);
+  }
+
+  new (ultimo->valores() + ultimo->quantidade) Type(std::move(dado));
+  ++ultimo->quantidade;
+  ++tamanho;
+}
+
+template <typename Type, size_t ElementosPorNo, typename Allocator>
+void ListaDesenrolada<Type, ElementosPorNo, Allocator>::insert(Type dado, size_t posicao) {
+  if (posicao > tamanho) {
+    throw std::out_of_range("Posicao invalida (maior que o tamanho da lista)");
+  }
+
+  // No fim, a inserção é um push_back (que só enche o último nó, sem dividi-lo)
+  if (posicao == tamanho) {
+    push_back(std::move(dado));
+    return;
+  }
+
+  size_t indice;
+  Node* node = localizar(posicao, indice);
+  inserirEm(node, indice, std::move(dado));
+}
+
+template <typename Type, size_t ElementosPorNo, typename Allocator>
+void ListaDesenrolada<Type, ElementosPorNo, Allocator>::remove(size_t posicao) {
+  if (posicao >= tamanho) {
+    throw std::out_of_range("Posicao invalida (maior ou igual ao tamanho da lista)");
+  }
+
+  size_t indice;
+  Node* node = localizar(posicao, indice);
+
+  removerDoNo(node, indice);
+  --tamanho;
+  rebalancear(node);
+}
+
+template <typename Type, size_t ElementosPorNo, typename Allocator>
+void ListaDesenrolada<Type, ElementosPorNo, Allocator>::clear() {
+  // Com uma arena e valores de destrutor trivial, os nós são abandonados sem serem percorridos
+  if (!DescarteSemPercurso<Allocator, Type>::value) {
+    Node* atual = primeiro;
+
+    while (atual != nullptr) {
+      Node* posterior = atual->proximo;
+
+      for (size_t i = 0; i < atual->quantidade; ++i) atual->valores()[i].~Type();
+      TraitsNo::destroy(alocador, atual);
+      TraitsNo::deallocate(alocador, atual, 1);
+
+      atual = posterior;
+    }
+  }
+
+  primeiro = nullptr;
+  ultimo = nullptr;
+  tamanho = 0;
+  quantidadeNos = 0;
+}
+
+template <typename Type, size_t ElementosPorNo, typename Allocator>
+void ListaDesenrolada<Type, ElementosPorNo, Allocator>::reverse() {
+  Node* atual = primeiro;
+
+  while (atual != nullptr) {
+    std::reverse(atual->valores(), atual->valores() + atual->quantidade);
+
+    // Troca os ponteiros do nó; o próximo nó a visitar é o antigo `proximo`
+    std::swap(atual->anterior, atual->proximo);
+    atual = atual->anterior;
+  }
+
+  std::swap(primeiro, ultimo);
+
+  // O antigo último nó, que não precisava ter a ocupação mínima, agora é o primeiro
+  if (primeiro != nullptr) rebalancear(primeiro);
+}
+
+template <typename Type, size_t ElementosPorNo, typename Allocator>
+void ListaDesenrolada<Type, ElementosPorNo, Allocator>::print() {
+  if (tamanho == 0) {
+    std::cout << "A lista esta vazia!" << std::endl;
+    return;
+  }
+
+  // Percorre e imprime os elementos da lista
+  for (const Node* node = primeiro; node != nullptr; node = node->proximo) {
+    for (size_t i = 0; i < node->quantidade; ++i) {
+      std::cout << node->valores()[i] << " ";
+    }
+  }
+
+  std::cout << std::endl;
+}
+
+template <typename Type, size_t ElementosPorNo, typename Allocator>
+size_t ListaDesenrolada<Type, ElementosPorNo, Allocator>::size() const {
+  return tamanho;
+}
+
+template <typename Type, size_t ElementosPorNo, typename Allocator>
+size_t ListaDesenrolada<Type, ElementosPorNo, Allocator>::memoryUsage() const {
+  return quantidadeNos * sizeof(Node);
+}
+
+template <typename Type, size_t ElementosPorNo, typename Allocator>
+typename ListaDesenrolada<Type, ElementosPorNo, Allocator>::const_iterator
+ListaDesenrolada<Type, ElementosPorNo, Allocator>::begin() const {
+  return const_iterator(primeiro, 0);
+}
+
+template <typename Type, size_t ElementosPorNo, typename Allocator>
+typename ListaDesenrolada<Type, ElementosPorNo, Allocator>::const_iterator
+ListaDesenrolada<Type, ElementosPorNo, Allocator>::end() const {
+  return const_iterator(nullptr, 0);
+}
+
+template <typename Type, size_t ElementosPorNo, typename Allocator>
+Allocator ListaDesenrolada<Type, ElementosPorNo, Allocator>::get_allocator() const {
+  return Allocator(alocador);
+}
+
+#endif
@@ -1,67 +1,394 @@
-#ifndef LISTA_DUPLA.HPP
-#define LISTA_DUPLA .HPP
+#ifndef LISTA_DUPLA_HPP
+#define LISTA_DUPLA_HPP
+
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "../allocators/AlocadorMonotonico.hpp"
 
 /**
  * @brief Lista duplamente ligada
  *
+ * A lista é circular em torno de um nó sentinela, que não guarda dado: o próximo da sentinela é o
+ * primeiro nó e o anterior dela é o último. Assim inserções e remoções nas duas pontas (e em volta
+ * de qualquer nó conhecido) são O(1) e nunca precisam tratar a lista vazia como caso especial.
+ *
+ * Os iteradores funcionam como handles: continuam válidos até o nó deles ser removido (mesmo se o
+ * nó for movido para outra lista por `splice`), e `erase`, `insert`, `move_to_front`/`move_to_back`
+ * e `splice` com iteradores são O(1).
+ *
  * @tparam Type
+ * @tparam Allocator Alocador usado para os nós (por exemplo, `PoolAllocator` ou `ArenaAllocator`)
  */
-template <typename Type>
+template <typename Type, typename Allocator = std::allocator<Type>>
 class ListaDupla {
  private:
-  struct Node {
-    Type dado;
-
+  /**
+   * @brief Ligações de um nó; a sentinela tem apenas as ligações
+   *
+   */
+  struct Elo {
     /**
      * @brief Aponta para o nó anterior
      *
      */
-    Node* anterior;
+    Elo* anterior;
 
     /**
      * @brief Aponta para o próximo nó
      *
      */
-    Node* proximo;
+    Elo* proximo;
+  };
+
+  struct Node : Elo {
+    Type dado;
 
-    Node(Type dado) : dado(dado), anterior(nullptr), proximo(nullptr) {}
+    Node(Type dado) : Elo{nullptr, nullptr}, dado(dado) {}
   };
 
   /**
-   * @brief Ponteiro para o primeiro nó da lista
+   * @brief Nó sentinela: `sentinela.proximo` é o primeiro nó e `sentinela.anterior` o último
    *
    */
-  Node* primeiro;
+  Elo sentinela;
 
   /**
-   * @brief Ponteiro para o último nó da lista
+   * @brief Número de elementos na lista
    *
    */
-  Node* ultimo;
+  size_t tamanho;
+
+  using AlocadorNo = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using TraitsNo = std::allocator_traits<AlocadorNo>;
+
+  AlocadorNo alocador;
+
+ public:
+  class const_iterator;
 
   /**
-   * @brief Número de elementos na lista
+   * @brief Iterador bidirecional; também serve como handle de um nó
    *
    */
-  size_t tamanho;
+  class iterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Type*;
+    using reference = Type&;
 
- public:
-  ListaDupla() : primeiro(nullptr), ultimo(nullptr), tamanho(0) {};
-  ListaDupla(const ListaLigada2<Type>& outraLista);
+    iterator() : elo(nullptr) {}
+
+    reference operator*() const { return static_cast<Node*>(elo)->dado; }
+    pointer operator->() const { return &static_cast<Node*>(elo)->dado; }
+
+    iterator& operator++() {
+      elo = elo->proximo;
+      return *this;
+    }
+
+    iterator operator++(int) {
+      iterator anterior = *this;
+      elo = elo->proximo;
+      return anterior;
+    }
+
+    iterator& operator--() {
+      elo = elo->anterior;
+      return *this;
+    }
+
+    iterator operator--(int) {
+      iterator posterior = *this;
+      elo = elo->anterior;
+      return posterior;
+    }
+
+    bool operator==(const iterator& outro) const { return elo == outro.elo; }
+    bool operator!=(const iterator& outro) const { return elo != outro.elo; }
+
+   private:
+    /**
+     * @brief Nó atual (a sentinela representa o fim)
+     *
+     */
+    Elo* elo;
+
+    explicit iterator(Elo* elo) : elo(elo) {}
+
+    friend class const_iterator;
+    friend class ListaDupla<Type, Allocator>;
+  };
+
+  /**
+   * @brief Iterador bidirecional (somente leitura)
+   *
+   */
+  class const_iterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Type*;
+    using reference = const Type&;
+
+    const_iterator() : elo(nullptr) {}
+    const_iterator(const iterator& outro) : elo(outro.elo) {}
+
+    reference operator*() const { return static_cast<const Node*>(elo)->dado; }
+    pointer operator->() const { return &static_cast<const Node*>(elo)->dado; }
+
+    const_iterator& operator++() {
+      elo = elo->proximo;
+      return *this;
+    }
+
+    const_iterator operator++(int) {
+      const_iterator anterior = *this;
+      elo = elo->proximo;
+      return anterior;
+    }
+
+    const_iterator& operator--() {
+      elo = elo->anterior;
+      return *this;
+    }
+
+    const_iterator operator--(int) {
+      const_iterator posterior = *this;
+      elo = elo->anterior;
+      return posterior;
+    }
+
+    bool operator==(const const_iterator& outro) const { return elo == outro.elo; }
+    bool operator!=(const const_iterator& outro) const { return elo != outro.elo; }
+
+   private:
+    /**
+     * @brief Nó atual (a sentinela representa o fim)
+     *
+     */
+    const Elo* elo;
+
+    explicit const_iterator(const Elo* elo) : elo(elo) {}
+
+    friend class ListaDupla<Type, Allocator>;
+  };
+
+  // Construtores (o construtor cópia é implementado mais abaixo)
+  ListaDupla() : ListaDupla(Allocator()) {}
+  explicit ListaDupla(const Allocator& alocador)
+      : sentinela{&sentinela, &sentinela}, tamanho(0), alocador(alocador) {}
+  ListaDupla(const ListaDupla<Type, Allocator>& outraLista);
+  // Construtor de movimentação: religa os nós da outra lista na sentinela desta
+  ListaDupla(ListaDupla<Type, Allocator>&& outraLista) noexcept;
+  // A sentinela é um membro, então a cópia por atribuição padrão deixaria ponteiros para a outra
+  // lista
+  ListaDupla<Type, Allocator>& operator=(const ListaDupla<Type, Allocator>&) = delete;
+  // Destrutor (implementado mais abaixo)
   ~ListaDupla();
 
+  /**
+   * @brief Remove o primeiro elemento da lista, em O(1)
+   *
+   * @throw `std::out_of_range` se a lista estiver vazia
+   */
   void pop_front();
 
+  /**
+   * @brief Remove o último elemento da lista, em O(1)
+   *
+   * @throw `std::out_of_range` se a lista estiver vazia
+   */
   void pop_back();
 
+  /**
+   * @brief Adiciona um novo elemento no início da lista, em O(1)
+   *
+   * @param dado Novo dado que será adicionado na lista
+   */
   void push_front(Type dado);
 
+  /**
+   * @brief Adiciona um novo elemento no final da lista, em O(1)
+   *
+   * @param dado Novo dado que será adicionado na lista
+   */
   void push_back(Type dado);
 
+  /**
+   * @brief Adiciona um novo elemento em uma dada posição da lista
+   *
+   * O nó da posição é alcançado a partir da ponta mais próxima, em O(min(posicao, n - posicao)).
+   *
+   * @param dado Novo dado que será adicionado na lista
+   * @param posicao Índice da lista onde será adicionado um novo elemento
+   *
+   * @throw `std::out_of_range` se a posição for maior que o tamanho da lista
+   */
   void insert(Type dado, size_t posicao);
 
+  /**
+   * @brief Adiciona um novo elemento antes do nó de `posicao`, em O(1)
+   *
+   * @param posicao Iterador do nó que ficará depois do novo elemento (`end()` insere no final)
+   * @param dado Novo dado que será adicionado na lista
+   * @return iterator Handle do novo elemento
+   */
+  iterator insert(const_iterator posicao, Type dado);
+
+  /**
+   * @brief Remove um elemento em uma dada posição da lista
+   *
+   * O nó da posição é alcançado a partir da ponta mais próxima, em O(min(posicao, n - posicao)).
+   *
+   * @param posicao Índice da lista que será removido
+   *
+   * @throw `std::out_of_range` se a posição for maior ou igual ao tamanho da
+   * lista
+   */
   void remove(size_t posicao);
 
+  /**
+   * @brief Remove o elemento de um handle, em O(1)
+   *
+   * @param posicao Iterador de um elemento da lista (não pode ser `end()`)
+   * @return iterator Iterador do elemento seguinte ao removido
+   */
+  iterator erase(const_iterator posicao);
+
+  /**
+   * @brief Move o elemento de um handle para o início da lista, em O(1)
+   *
+   * Nenhum nó é alocado ou copiado, e o handle continua válido.
+   *
+   * @param posicao Iterador de um elemento da lista (não pode ser `end()`)
+   */
+  void move_to_front(const_iterator posicao);
+
+  /**
+   * @brief Move o elemento de um handle para o final da lista, em O(1)
+   *
+   * Nenhum nó é alocado ou copiado, e o handle continua válido.
+   *
+   * @param posicao Iterador de um elemento da lista (não pode ser `end()`)
+   */
+  void move_to_back(const_iterator posicao);
+
+  /**
+   * @brief Move um elemento de `outra` para antes de `posicao` nesta lista, em O(1)
+   *
+   * O nó é apenas religado, sem ser alocado ou copiado, e o handle dele continua válido (agora
+   * nesta lista). As duas listas precisam ter alocadores iguais.
+   *
+   * @param posicao Iterador desta lista que ficará depois do elemento movido
+   * @param outra Lista que contém o elemento (pode ser esta mesma lista)
+   * @param elemento Iterador do elemento em `outra` (não pode ser `end()`)
+   */
+  void splice(const_iterator posicao, ListaDupla<Type, Allocator>& outra, const_iterator elemento);
+
+  /**
+   * @brief Move todos os elementos de `outra` para antes de `posicao`, em O(1)
+   *
+   * Os nós são apenas religados, sem alocações nem cópias, e `outra` fica vazia. As duas listas
+   * precisam ter alocadores iguais. Não faz nada se `outra` for esta lista.
+   *
+   * @param posicao Iterador desta lista que ficará depois dos elementos movidos
+   * @param outra Lista de origem
+   */
+  void splice(const_iterator posicao, ListaDupla<Type, Allocator>& outra);
+
+  /**
+   * @brief Move os elementos de [primeiro, ultimo) de `outra` para antes de `posicao`
+   *
+   * Os nós são apenas religados, sem alocações nem cópias. É O(1) dentro da mesma lista (e então
+   * `posicao` não pode estar no trecho); entre listas diferentes o trecho é percorrido uma vez para
+   * contar os elementos. As duas listas precisam ter alocadores iguais.
+   *
+   * @param posicao Iterador desta lista que ficará depois dos elementos movidos
+   * @param outra Lista de origem (pode ser esta mesma lista)
+   * @param primeiro Iterador do primeiro elemento movido
+   * @param ultimo Iterador seguinte ao último elemento movido
+   */
+  void splice(const_iterator posicao, ListaDupla<Type, Allocator>& outra, const_iterator primeiro,
+              const_iterator ultimo);
+
+  /**
+   * @brief Move os elementos das posições [inicio, fim) de `outra` para antes da posição `posicao`
+   * desta lista
+   *
+   * Os nós são apenas religados, sem alocações nem cópias. As posições são alcançadas a partir da
+   * ponta mais próxima de cada lista, e a quantidade movida já é conhecida, então o trecho não é
+   * percorrido. As duas listas precisam ter alocadores iguais.
+   *
+   * @param posicao Índice desta lista onde o primeiro elemento movido ficará
+   * @param outra Lista de origem (diferente desta)
+   * @param inicio Índice do primeiro elemento movido
+   * @param fim Índice seguinte ao último elemento movido
+   *
+   * @throw `std::out_of_range` se a posição for maior que o tamanho da lista, ou se o trecho não
+   * estiver dentro de `outra`
+   * @throw `std::invalid_argument` se `outra` for esta lista
+   */
+  void splice(size_t posicao, ListaDupla<Type, Allocator>& outra, size_t inicio, size_t fim);
+
+  /**
+   * @brief Move todos os elementos de `outra` para o final desta lista, em O(1)
+   *
+   * As duas listas precisam ter alocadores iguais.
+   *
+   * @param outra Lista de origem, que fica vazia
+   */
+  void append(ListaDupla<Type, Allocator>&& outra);
+
+  /**
+   * @brief Divide a lista na posição `posicao`
+   *
+   * Esta lista fica com os elementos [0, posicao) e os demais são movidos, sem alocações nem
+   * cópias, para a lista retornada. O ponto de divisão é alcançado a partir da ponta mais próxima.
+   *
+   * @param posicao Índice do primeiro elemento da lista retornada
+   * @return ListaDupla<Type, Allocator> Lista com os elementos [posicao, size())
+   *
+   * @throw `std::out_of_range` se a posição for maior que o tamanho da lista
+   */
+  ListaDupla<Type, Allocator> split_at(size_t posicao);
+
+  /**
+   * @brief Retorna o elemento de uma dada posição da lista
+   *
+   * O nó da posição é alcançado a partir da ponta mais próxima, em O(min(posicao, n - posicao)).
+   *
+   * @param posicao Índice do elemento
+   *
+   * @throw `std::out_of_range` se a posição for maior ou igual ao tamanho da
+   * lista
+   */
+  Type& at(size_t posicao);
+  const Type& at(size_t posicao) const;
+
+  /**
+   * @brief Retorna o primeiro elemento da lista
+   *
+   * @throw `std::out_of_range` se a lista estiver vazia
+   */
+  Type& front();
+  const Type& front() const;
+
+  /**
+   * @brief Retorna o último elemento da lista
+   *
+   * @throw `std::out_of_range` se a lista estiver vazia
+   */
+  Type& back();
+  const Type& back() const;
+
   /**
    * @brief Limpa (reseta) completamente a lista
    *
@@ -79,6 +406,492 @@ class ListaDupla {
    *
    */
   void print();
+
+  /**
+   * @brief Retorna o número de elementos da lista
+   *
+   * @return size_t
+   */
+  size_t size() const;
+
+  /**
+   * @brief Retorna se a lista está ou não vazia
+   *
+   */
+  bool isEmpty() const;
+
+  /**
+   * @brief Retorna quantos bytes os nós da lista ocupam
+   *
+   * Não inclui o espaço desperdiçado pelo alocador em cada alocação.
+   *
+   * @return size_t
+   */
+  size_t memoryUsage() const;
+
+  /**
+   * @brief Retorna um iterador para o primeiro elemento
+   *
+   */
+  iterator begin();
+  const_iterator begin() const;
+
+  /**
+   * @brief Retorna o iterador que representa o fim da lista (a sentinela)
+   *
+   */
+  iterator end();
+  const_iterator end() const;
+
+  /**
+   * @brief Retorna uma cópia do alocador da lista
+   *
+   * @return Allocator
+   */
+  Allocator get_allocator() const;
+
+ private:
+  Node* criarNo(const Type& valor);
+  void liberarNo(Node* node);
+
+  /**
+   * @brief Liga `elo` antes de `posicao`
+   *
+   */
+  static void ligar(Elo* posicao, Elo* elo);
+
+  /**
+   * @brief Desliga `elo` dos vizinhos, sem liberá-lo
+   *
+   */
+  static void desligar(Elo* elo);
+
+  /**
+   * @brief Desliga a cadeia [primeiro, ultimo] (inclusive) e a liga antes de `posicao`
+   *
+   */
+  static void transferir(Elo* posicao, Elo* primeiro, Elo* ultimo);
+
+  /**
+   * @brief Retorna o elo de uma posição (a sentinela se `posicao == tamanho`), andando a partir da
+   * ponta mais próxima
+   *
+   */
+  Elo* localizar(size_t posicao) const;
 };
 
-#endif
\ No newline at end of file
+template <typename Type, typename Allocator>
+ListaDupla<Type, Allocator>::ListaDupla(const ListaDupla<Type, Allocator>& outraLista)
+    : ListaDupla(std::allocator_traits<Allocator>::select_on_container_copy_construction(
+          outraLista.get_allocator())) {
+  for (const Type& valor : outraLista) {
+    push_back(valor);
+  }
+}
+
+template <typename Type, typename Allocator>
+ListaDupla<Type, Allocator>::ListaDupla(ListaDupla<Type, Allocator>&& outraLista) noexcept
+    : ListaDupla(outraLista.get_allocator()) {
+  append(std::move(outraLista));
+}
+
+template <typename Type, typename Allocator>
+ListaDupla<Type, Allocator>::~ListaDupla() {
+  clear();
+}
+
+template <typename Type, typename Allocator>
+void ListaDupla<Type, Allocator>::ligar(typename ListaDupla<Type, Allocator>::Elo* posicao,
+                                        typename ListaDupla<Type, Allocator>::Elo* elo) {
+  elo->anterior = posicao->anterior;
+  elo->proximo = posicao;
+  posicao->anterior->proximo = elo;
+  posicao->anterior = elo;
+}
+
+template <typename Type, typename Allocator>
+void ListaDupla<Type, Allocator>::desligar(typename ListaDupla<Type, Allocator>::Elo* elo) {
+  elo->anterior->proximo = elo->proximo;
+  elo->proximo->anterior = elo->anterior;
+}
+
+template <typename Type, typename Allocator>
+void ListaDupla<Type, Allocator>::transferir(typename ListaDupla<Type, Allocator>::Elo* posicao,
+                                             typename ListaDupla<Type, Allocator>::Elo* primeiro,
+                                             typename ListaDupla<Type, Allocator>::Elo* ultimo) {
+  // Desliga a cadeia dos vizinhos atuais
+  primeiro->anterior->proximo = ultimo->proximo;
+  ultimo->proximo->anterior = primeiro->anterior;
+
+  // Liga a cadeia entre o anterior de `posicao` e `posicao`
+  primeiro->anterior = posicao->anterior;
+  ultimo->proximo = posicao;
+  posicao->anterior->proximo = primeiro;
+  posicao->anterior = ultimo;
+}
+
+template <typename Type, typename Allocator>
+typename ListaDupla<Type, Allocator>::Elo* ListaDupla<Type, Allocator>::localizar(
+    size_t posicao) const {
+  Elo* atual = const_cast<Elo*>(&sentinela);
+
+  if (posicao <= tamanho / 2) {
+    // Mais perto do início: anda para frente a partir do primeiro nó
+    atual = atual->proximo;
+    for (size_t i = 0; i < posicao; ++i) {
+      atual = atual->proximo;
+    }
+  } else {
+    // Mais perto do fim: anda para trás a partir da sentinela
+    for (size_t i = tamanho; i > posicao; --i) {
+      atual = atual->anterior;
+    }
+  }
+
+  return atual;
+}
+
+template <typename Type, typename Allocator>
+void ListaDupla<Type, Allocator>::pop_front() {
+  if (tamanho == 0) {
+    throw std::out_of_range("A lista esta vazia!");
+  }
+
+  erase(begin());
+}
+
+template <typename Type, typename Allocator>
+void ListaDupla<Type, Allocator>::pop_back() {
+  if (tamanho == 0) {
+    throw std::out_of_range("A lista esta vazia!");
+  }
+
+  erase(const_iterator(sentinela.anterior));
+}
+
+template <typename Type, typename Allocator>
+void ListaDupla<Type, Allocator>::push_front(Type dado) {
+  ligar(sentinela.proximo, criarNo(dado));
+  ++tamanho;
+}
+
+template <typename Type, typename Allocator>
+void ListaDupla<Type, Allocator>::push_back(Type dado) {
+  ligar(&sentinela, criarNo(dado));
+  ++tamanho;
+}
+
+template <typename Type, typename Allocator>
+void ListaDupla<Type, Allocator>::insert(Type dado, size_t posicao) {
+  if (posicao > tamanho) {
+    throw std::out_of_range("Posicao invalida (maior que o tamanho da lista)");
+  }
+
+  // O novo nó fica antes do nó que hoje ocupa a posição (ou antes da sentinela, no final)
+  ligar(localizar(posicao), criarNo(dado));
+  ++tamanho;
+}
+
+template <typename Type, typename Allocator>
+typename ListaDupla<Type, Allocator>::iterator ListaDupla<Type, Allocator>::insert(
+    typename ListaDupla<Type, Allocator>::const_iterator posicao, Type dado) {
+  Node* novo = criarNo(dado);
+  ligar(const_cast<Elo*>(posicao.elo), novo);
+  ++tamanho;
+
+  return iterator(novo);
+}
+
+template <typename Type, typename Allocator>
+void ListaDupla<Type, Allocator>::remove(size_t posicao) {
+  if (posicao >= tamanho) {
+    throw std::out_of_range("Posicao invalida (maior ou igual ao tamanho da lista)");
+  }
+
+  erase(const_iterator(localizar(posicao)));
+}
+
+template <typename Type, typename Allocator>
+typename ListaDupla<Type, Allocator>::iterator ListaDupla<Type, Allocator>::erase(
+    typename ListaDupla<Type, Allocator>::const_iterator posicao) {
+  Elo* elo = const_cast<Elo*>(posicao.elo);
+  Elo* posterior = elo->proximo;
+
+  desligar(elo);
+  liberarNo(static_cast<Node*>(elo));
+  --tamanho;
+
+  return iterator(posterior);
+}
+
+template <typename Type, typename Allocator>
+void ListaDupla<Type, Allocator>::move_to_front(
+    typename ListaDupla<Type, Allocator>::const_iterator posicao) {
+  Elo* elo = const_cast<Elo*>(posicao.elo);
+  if (elo == sentinela.proximo) return;
+
+  desligar(elo);
+  ligar(sentinela.proximo, elo);
+}
+
+template <typename Type, typename Allocator>
+void ListaDupla<Type, Allocator>::move_to_back(
+    typename ListaDupla<Type, Allocator>::const_iterator posicao) {
+  Elo* elo = const_cast<Elo*>(posicao.elo);
+  if (elo == sentinela.anterior) return;
+
+  desligar(elo);
+  ligar(&sentinela, elo);
+}
+
+template <typename Type, typename Allocator>
+void ListaDupla<Type, Allocator>::splice(
+    typename ListaDupla<Type, Allocator>::const_iterator posicao,
+    ListaDupla<Type, Allocator>& outra,
+    typename ListaDupla<Type, Allocator>::const_iterator elemento) {
+  Elo* destino = const_cast<Elo*>(posicao.elo);
+  Elo* elo = const_cast<Elo*>(elemento.elo);
+  if (elo == destino || elo->proximo == destino) return;
+
+  transferir(destino, elo, elo);
+
+  --outra.tamanho;
+  ++tamanho;
+}
+
+template <typename Type, typename Allocator>
+void ListaDupla<Type, Allocator>::splice(
+    typename ListaDupla<Type, Allocator>::const_iterator posicao,
+    ListaDupla<Type, Allocator>& outra) {
+  if (&outra == this || outra.tamanho == 0) return;
+
+  transferir(const_cast<Elo*>(posicao.elo), outra.sentinela.proximo, outra.sentinela.anterior);
+
+  tamanho += outra.tamanho;
+  outra.tamanho = 0;
+}
+
+template <typename Type, typename Allocator>
+void ListaDupla<Type, Allocator>::splice(
+    typename ListaDupla<Type, Allocator>::const_iterator posicao,
+    ListaDupla<Type, Allocator>& outra,
+    typename ListaDupla<Type, Allocator>::const_iterator primeiro,
+    typename ListaDupla<Type, Allocator>::const_iterator ultimo) {
+  if (primeiro == ultimo) return;
+
+  Elo* destino = const_cast<Elo*>(posicao.elo);
+  Elo* inicioTrecho = const_cast<Elo*>(primeiro.elo);
+  Elo* fimTrecho = const_cast<Elo*>(ultimo.elo)->anterior;
+  if (&outra == this && (destino == inicioTrecho || destino == ultimo.elo)) return;  // Já no lugar
+
+  if (&outra != this) {
+    size_t quantidade = static_cast<size_t>(std::distance(primeiro, ultimo));
+    outra.tamanho -= quantidade;
+    tamanho += quantidade;
+  }
+
+  transferir(destino, inicioTrecho, fimTrecho);
+}
+
+template <typename Type, typename Allocator>
+void ListaDupla<Type, Allocator>::splice(size_t posicao, ListaDupla<Type, Allocator>& outra,
+                                         size_t inicio, size_t fim) {
+  if (&outra == this) {
+    throw std::invalid_argument("A lista de origem deve ser diferente da lista de destino");
+  }
+
+  if (posicao > tamanho) {
+    throw std::out_of_range("Posicao invalida (maior que o tamanho da lista)");
+  }
+
+  if (inicio > fim || fim > outra.tamanho) {
+    throw std::out_of_range("Trecho invalido (fora da lista de origem)");
+  }
+
+  size_t quantidade = fim - inicio;
+  if (quantidade == 0) return;
+
+  Elo* inicioTrecho = outra.localizar(inicio);
+  Elo* fimTrecho = outra.localizar(fim)->anterior;
+  transferir(localizar(posicao), inicioTrecho, fimTrecho);
+
+  outra.tamanho -= quantidade;
+  tamanho += quantidade;
+}
+
+template <typename Type, typename Allocator>
+void ListaDupla<Type, Allocator>::append(ListaDupla<Type, Allocator>&& outra) {
+  splice(end(), outra);
+}
+
+template <typename Type, typename Allocator>
+ListaDupla<Type, Allocator> ListaDupla<Type, Allocator>::split_at(size_t posicao) {
+  if (posicao > tamanho) {
+    throw std::out_of_range("Posicao invalida (maior que o tamanho da lista)");
+  }
+
+  // A lista nova usa o mesmo alocador, que vai liberar os nós movidos
+  ListaDupla<Type, Allocator> resto(get_allocator());
+  resto.splice(0, *this, posicao, tamanho);
+
+  return resto;
+}
+
+template <typename Type, typename Allocator>
+Type& ListaDupla<Type, Allocator>::at(size_t posicao) {
+  if (posicao >= tamanho) {
+    throw std::out_of_range("Posicao invalida (maior ou igual ao tamanho da lista)");
+  }
+
+  return static_cast<Node*>(localizar(posicao))->dado;
+}
+
+template <typename Type, typename Allocator>
+const Type& ListaDupla<Type, Allocator>::at(size_t posicao) const {
+  if (posicao >= tamanho) {
+    throw std::out_of_range("Posicao invalida (maior ou igual ao tamanho da lista)");
+  }
+
+  return static_cast<const Node*>(localizar(posicao))->dado;
+}
+
+template <typename Type, typename Allocator>
+Type& ListaDupla<Type, Allocator>::front() {
+  if (tamanho == 0) {
+    throw std::out_of_range("A lista esta vazia!");
+  }
+
+  return static_cast<Node*>(sentinela.proximo)->dado;
+}
+
+template <typename Type, typename Allocator>
+const Type& ListaDupla<Type, Allocator>::front() const {
+  if (tamanho == 0) {
+    throw std::out_of_range("A lista esta vazia!");
+  }
+
+  return static_cast<const Node*>(sentinela.proximo)->dado;
+}
+
+template <typename Type, typename Allocator>
+Type& ListaDupla<Type, Allocator>::back() {
+  if (tamanho == 0) {
+    throw std::out_of_range("A lista esta vazia!");
+  }
+
+  return static_cast<Node*>(sentinela.anterior)->dado;
+}
+
+template <typename Type, typename Allocator>
+const Type& ListaDupla<Type, Allocator>::back() const {
+  if (tamanho == 0) {
+    throw std::out_of_range("A lista esta vazia!");
+  }
+
+  return static_cast<const Node*>(sentinela.anterior)->dado;
+}
+
+template <typename Type, typename Allocator>
+void ListaDupla<Type, Allocator>::clear() {
+  // Com uma arena e valores de destrutor trivial, os nós são abandonados sem serem percorridos
+  if (!DescarteSemPercurso<Allocator, Type>::value) {
+    Elo* atual = sentinela.proximo;
+
+    while (atual != &sentinela) {
+      Elo* posterior = atual->proximo;
+      liberarNo(static_cast<Node*>(atual));
+      atual = posterior;
+    }
+  }
+
+  sentinela.proximo = &sentinela;
+  sentinela.anterior = &sentinela;
+  tamanho = 0;
+}
+
+template <typename Type, typename Allocator>
+void ListaDupla<Type, Allocator>::reverse() {
+  // Troca anterior e próximo de todos os elos, inclusive da sentinela
+  Elo* atual = &sentinela;
+
+  do {
+    std::swap(atual->anterior, atual->proximo);
+    atual = atual->anterior;
+  } while (atual != &sentinela);
+}
+
+template <typename Type, typename Allocator>
+void ListaDupla<Type, Allocator>::print() {
+  if (tamanho == 0) {
+    std::cout << "A lista esta vazia!" << std::endl;
+    return;
+  }
+
+  // Percorre e imprime os elementos da lista
+  for (const Type& valor : *this) {
+    std::cout << valor << " ";
+  }
+
+  std::cout << std::endl;
+}
+
+template <typename Type, typename Allocator>
+size_t ListaDupla<Type, Allocator>::size() const {
+  return tamanho;
+}
+
+template <typename Type, typename Allocator>
+bool ListaDupla<Type, Allocator>::isEmpty() const {
+  return tamanho == 0;
+}
+
+template <typename Type, typename Allocator>
+size_t ListaDupla<Type, Allocator>::memoryUsage() const {
+  return tamanho * sizeof(Node);
+}
+
+template <typename Type, typename Allocator>
+typename ListaDupla<Type, Allocator>::iterator ListaDupla<Type, Allocator>::begin() {
+  return iterator(sentinela.proximo);
+}
+
+template <typename Type, typename Allocator>
+typename ListaDupla<Type, Allocator>::const_iterator ListaDupla<Type, Allocator>::begin() const {
+  return const_iterator(sentinela.proximo);
+}
+
+template <typename Type, typename Allocator>
+typename ListaDupla<Type, Allocator>::iterator ListaDupla<Type, Allocator>::end() {
+  return iterator(&sentinela);
+}
+
+template <typename Type, typename Allocator>
+typename ListaDupla<Type, Allocator>::const_iterator ListaDupla<Type, Allocator>::end() const {
+  return const_iterator(&sentinela);
+}
+
+template <typename Type, typename Allocator>
+Allocator ListaDupla<Type, Allocator>::get_allocator() const {
+  return Allocator(alocador);
+}
+
+template <typename Type, typename Allocator>
+typename ListaDupla<Type, Allocator>::Node* ListaDupla<Type, Allocator>::criarNo(
+    const Type& valor) {
+  Node* node = TraitsNo::allocate(alocador, 1);
+  try {
+    TraitsNo::construct(alocador, node, valor);
+  } catch (...) {
+    TraitsNo::deallocate(alocador, node, 1);
+    throw;
+  }
+  return node;
+}
+
+template <typename Type, typename Allocator>
+void ListaDupla<Type, Allocator>::liberarNo(typename ListaDupla<Type, Allocator>::Node* node) {
+  TraitsNo::destroy(alocador, node);
+  TraitsNo::deallocate(alocador, node, 1);
+}
+
+#endif
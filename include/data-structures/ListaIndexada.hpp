@@ -0,0 +1,714 @@
+#ifndef LISTA_INDEXADA_HPP
+#define LISTA_INDEXADA_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+
+#include "../allocators/AlocadorMonotonico.hpp"
+
+/**
+ * @brief Sequência indexada: lista com `insert`, `remove` e `at` por posição em O(log n)
+ *
+ * Os elementos ficam em uma árvore AVL implícita: a ordem em que a árvore é percorrida (in-order) é
+ * a ordem da lista, e cada nó guarda o tamanho da sua subárvore. A posição de um nó é a quantidade
+ * de nós à esquerda dele, então as operações por posição descem a árvore comparando a posição com o
+ * tamanho da subárvore esquerda, em vez de percorrer os nós um a um.
+ *
+ * Como a altura é logarítmica, os métodos auxiliares podem ser recursivos sem risco de estourar a
+ * pilha de chamadas.
+ *
+ * @tparam Type
+ * @tparam Allocator Alocador usado para os nós
+ */
+template <typename Type, typename Allocator = std::allocator<Type>>
+class ListaIndexada {
+ private:
+  struct Node {
+    Type valor;
+    Node* left;
+    Node* right;
+
+    /**
+     * @brief Aponta para o pai do nó (`nullptr` na raiz), usado pelos iteradores
+     *
+     */
+    Node* pai;
+
+    /**
+     * @brief Altura da subárvore cuja raiz é este nó (uma folha tem altura 1)
+     *
+     */
+    int altura;
+
+    /**
+     * @brief Quantidade de nós da subárvore cuja raiz é este nó (incluindo ele mesmo)
+     *
+     */
+    size_t tamanho;
+
+    Node(Type valor)
+        : valor(valor), left(nullptr), right(nullptr), pai(nullptr), altura(1), tamanho(1) {}
+  };
+
+  using AlocadorNo = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using TraitsNo = std::allocator_traits<AlocadorNo>;
+
+  Node* raiz;
+  AlocadorNo alocador;
+
+ public:
+  /**
+   * @brief Iterador (somente leitura) que percorre a lista do início ao fim
+   *
+   */
+  class const_iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Type*;
+    using reference = const Type&;
+
+    const_iterator() : node(nullptr) {}
+
+    reference operator*() const { return node->valor; }
+    pointer operator->() const { return &node->valor; }
+
+    const_iterator& operator++();
+    const_iterator operator++(int);
+
+    bool operator==(const const_iterator& outro) const { return node == outro.node; }
+    bool operator!=(const const_iterator& outro) const { return node != outro.node; }
+
+   private:
+    /**
+     * @brief Nó atual (`nullptr` representa o fim)
+     *
+     */
+    const Node* node;
+
+    explicit const_iterator(const Node* node) : node(node) {}
+
+    friend class ListaIndexada<Type, Allocator>;
+  };
+
+  using iterator = const_iterator;
+
+  // Construtores (o construtor cópia é implementado mais abaixo)
+  ListaIndexada() : ListaIndexada(Allocator()) {}
+  explicit ListaIndexada(const Allocator& alocador) : raiz(nullptr), alocador(alocador) {}
+  ListaIndexada(const ListaIndexada<Type, Allocator>& outraLista);
+  ListaIndexada<Type, Allocator>& operator=(const ListaIndexada<Type, Allocator>&) = delete;
+  // Destrutor (implementado mais abaixo)
+  ~ListaIndexada();
+
+  /**
+   * @brief Remove o primeiro elemento da lista
+   *
+   * @throw `std::out_of_range` se a lista estiver vazia
+   */
+  void pop_front();
+
+  /**
+   * @brief Remove o último elemento da lista
+   *
+   * @throw `std::out_of_range` se a lista estiver vazia
+   */
+  void pop_back();
+
+  /**
+   * @brief Adiciona um novo elemento no início da lista
+   *
+   * @param dado Novo dado que será adicionado na lista
+   */
+  void push_front(Type dado);
+
+  /**
+   * @brief Adiciona um novo elemento no final da lista
+   *
+   * @param dado Novo dado que será adicionado na lista
+   */
+  void push_back(Type dado);
+
+  /**
+   * @brief Adiciona um novo elemento em uma dada posição da lista, em O(log n)
+   *
+   * @param dado Novo dado que será adicionado na lista
+   * @param posicao Índice da lista onde será adicionado um novo elemento
+   *
+   * @throw `std::out_of_range` se a posição for maior que o tamanho da lista
+   */
+  void insert(Type dado, size_t posicao);
+
+  /**
+   * @brief Remove um elemento em uma dada posição da lista, em O(log n)
+   *
+   * @param posicao Índice da lista que será removido
+   *
+   * @throw `std::out_of_range` se a posição for maior ou igual ao tamanho da
+   * lista
+   */
+  void remove(size_t posicao);
+
+  /**
+   * @brief Retorna o elemento de uma dada posição da lista, em O(log n)
+   *
+   * @param posicao Índice do elemento
+   *
+   * @throw `std::out_of_range` se a posição for maior ou igual ao tamanho da
+   * lista
+   */
+  Type& at(size_t posicao);
+  const Type& at(size_t posicao) const;
+
+  /**
+   * @brief Limpa (reseta) completamente a lista
+   *
+   */
+  void clear();
+
+  /**
+   * @brief Inverte todos elementos da lista
+   *
+   * Troca os filhos esquerdo e direito de todos os nós, o que inverte a ordem in-order sem alterar
+   * alturas nem tamanhos.
+   */
+  void reverse();
+
+  /**
+   * @brief Imprime todos elementos da lista
+   *
+   */
+  void print();
+
+  /**
+   * @brief Retorna o número de elementos da lista
+   *
+   * @return size_t
+   */
+  size_t size() const;
+
+  /**
+   * @brief Retorna quantos bytes os nós da lista ocupam
+   *
+   * @return size_t
+   */
+  size_t memoryUsage() const;
+
+  /**
+   * @brief Retorna se a lista está ou não vazia
+   *
+   */
+  bool isEmpty() const;
+
+  /**
+   * @brief Retorna a altura da árvore que guarda os elementos
+   *
+   * @return size_t
+   */
+  size_t height() const;
+
+  /**
+   * @brief Retorna um iterador para o primeiro elemento
+   *
+   */
+  const_iterator begin() const;
+
+  /**
+   * @brief Retorna o iterador que representa o fim da lista
+   *
+   */
+  const_iterator end() const;
+
+  /**
+   * @brief Retorna uma cópia do alocador da lista
+   *
+   * @return Allocator
+   */
+  Allocator get_allocator() const;
+
+ private:
+  Node* criarNo(const Type& valor);
+  void liberarNo(Node* node);
+
+  static int altura(const Node* node);
+  static size_t tamanho(const Node* node);
+  static int fatorBalanceamento(const Node* node);
+
+  /**
+   * @brief Recalcula a altura e o tamanho do nó a partir dos filhos
+   *
+   */
+  static void atualizar(Node* node);
+
+  /**
+   * @brief Rotação simples à direita; o filho esquerdo se torna a nova raiz da subárvore
+   *
+   * @return Node* Nova raiz da subárvore (com o mesmo pai da raiz antiga)
+   */
+  static Node* rotacaoDireita(Node* node);
+
+  /**
+   * @brief Rotação simples à esquerda; o filho direito se torna a nova raiz da subárvore
+   *
+   * @return Node* Nova raiz da subárvore (com o mesmo pai da raiz antiga)
+   */
+  static Node* rotacaoEsquerda(Node* node);
+
+  /**
+   * @brief Atualiza o nó e aplica a rotação (simples ou dupla) necessária
+   *
+   * @return Node* Nova raiz da subárvore
+   */
+  static Node* balancear(Node* node);
+
+  /**
+   * @brief Liga `filho` como filho esquerdo ou direito de `node`, atualizando o pai dele
+   *
+   */
+  static void ligarEsquerdo(Node* node, Node* filho);
+  static void ligarDireito(Node* node, Node* filho);
+
+  /**
+   * @brief Insere o nó `novo` na posição `posicao` da subárvore
+   *
+   * @return Node* Nova raiz da subárvore
+   */
+  static Node* inserir(Node* node, size_t posicao, Node* novo);
+
+  /**
+   * @brief Desliga o nó da posição `posicao` da subárvore
+   *
+   * @param removido Recebe o nó desligado
+   * @return Node* Nova raiz da subárvore
+   */
+  static Node* remover(Node* node, size_t posicao, Node*& removido);
+
+  /**
+   * @brief Desliga o menor nó da subárvore e retorna a nova raiz dela
+   *
+   * @param node Raiz da subárvore
+   * @param minimo Recebe o nó desligado
+   */
+  static Node* removerMinimo(Node* node, Node*& minimo);
+
+  /**
+   * @brief Retorna o nó da posição `posicao` (que deve existir)
+   *
+   */
+  Node* localizar(size_t posicao) const;
+
+  Node* copiar(const Node* node, Node* pai);
+  void destruir(Node* node);
+  static void inverter(Node* node);
+};
+
+template <typename Type, typename Allocator>
+ListaIndexada<Type, Allocator>::ListaIndexada(const ListaIndexada<Type, Allocator>& outraLista)
+    : ListaIndexada(std::allocator_traits<Allocator>::select_on_container_copy_construction(
+          outraLista.get_allocator())) {
+  raiz = copiar(outraLista.raiz, nullptr);
+}
+
+template <typename Type, typename Allocator>
+ListaIndexada<Type, Allocator>::~ListaIndexada() {
+  clear();
+}
+
+template <typename Type, typename Allocator>
+typename ListaIndexada<Type, Allocator>::Node* ListaIndexada<Type, Allocator>::copiar(
+    const typename ListaIndexada<Type, Allocator>::Node* node,
+    typename ListaIndexada<Type, Allocator>::Node* pai) {
+  if (node == nullptr) return nullptr;
+
+  // A cópia reproduz a estrutura nó a nó, sem precisar rebalancear
+  Node* novo = criarNo(node->valor);
+  novo->pai = pai;
+  novo->altura = node->altura;
+  novo->tamanho = node->tamanho;
+  novo->left = copiar(node->left, novo);
+  novo->right = copiar(node->right, novo);
+  return novo;
+}
+
+template <typename Type, typename Allocator>
+void ListaIndexada<Type, Allocator>::destruir(typename ListaIndexada<Type, Allocator>::Node* node) {
+  if (node == nullptr) return;
+
+  destruir(node->left);
+  destruir(node->right);
+  liberarNo(node);
+}
+
+template <typename Type, typename Allocator>
+typename ListaIndexada<Type, Allocator>::Node* ListaIndexada<Type, Allocator>::criarNo(
+    const Type& valor) {
+  Node* node = TraitsNo::allocate(alocador, 1);
+  try {
+    TraitsNo::construct(alocador, node, valor);
+  } catch (...) {
+    TraitsNo::deallocate(alocador, node, 1);
+    throw;
+  }
+  return node;
+}
+
+template <typename Type, typename Allocator>
+void ListaIndexada<Type, Allocator>::liberarNo(
+    typename ListaIndexada<Type, Allocator>::Node* node) {
+  TraitsNo::destroy(alocador, node);
+  TraitsNo::deallocate(alocador, node, 1);
+}
+
+template <typename Type, typename Allocator>
+int ListaIndexada<Type, Allocator>::altura(
+    const typename ListaIndexada<Type, Allocator>::Node* node) {
+  return node == nullptr ? 0 : node->altura;
+}
+
+template <typename Type, typename Allocator>
+size_t ListaIndexada<Type, Allocator>::tamanho(
+    const typename ListaIndexada<Type, Allocator>::Node* node) {
+  return node == nullptr ? 0 : node->tamanho;
+}
+
+template <typename Type, typename Allocator>
+int ListaIndexada<Type, Allocator>::fatorBalanceamento(
+    const typename ListaIndexada<Type, Allocator>::Node* node) {
+  return node == nullptr ? 0 : altura(node->left) - altura(node->right);
+}
+
+template <typename Type, typename Allocator>
+void ListaIndexada<Type, Allocator>::atualizar(
+    typename ListaIndexada<Type, Allocator>::Node* node) {
+  node->altura = 1 + std::max(altura(node->left), altura(node->right));
+  node->tamanho = 1 + tamanho(node->left) + tamanho(node->right);
+}
+
+template <typename Type, typename Allocator>
+void ListaIndexada<Type, Allocator>::ligarEsquerdo(
+    typename ListaIndexada<Type, Allocator>::Node* node,
+    typename ListaIndexada<Type, Allocator>::Node* filho) {
+  node->left = filho;
+  if (filho != nullptr) filho->pai = node;
+}
+
+template <typename Type, typename Allocator>
+void ListaIndexada<Type, Allocator>::ligarDireito(
+    typename ListaIndexada<Type, Allocator>::Node* node,
+    typename ListaIndexada<Type, Allocator>::Node* filho) {
+  node->right = filho;
+  if (filho != nullptr) filho->pai = node;
+}
+
+template <typename Type, typename Allocator>
+typename ListaIndexada<Type, Allocator>::Node* ListaIndexada<Type, Allocator>::rotacaoDireita(
+    typename ListaIndexada<Type, Allocator>::Node* node) {
+  Node* esquerdo = node->left;
+  esquerdo->pai = node->pai;
+  ligarEsquerdo(node, esquerdo->right);
+  ligarDireito(esquerdo, node);
+
+  atualizar(node);
+  atualizar(esquerdo);
+  return esquerdo;
+}
+
+template <typename Type, typename Allocator>
+typename ListaIndexada<Type, Allocator>::Node* ListaIndexada<Type, Allocator>::rotacaoEsquerda(
+    typename ListaIndexada<Type, Allocator>::Node* node) {
+  Node* direito = node->right;
+  direito->pai = node->pai;
+  ligarDireito(node, direito->left);
+  ligarEsquerdo(direito, node);
+
+  atualizar(node);
+  atualizar(direito);
+  return direito;
+}
+
+template <typename Type, typename Allocator>
+typename ListaIndexada<Type, Allocator>::Node* ListaIndexada<Type, Allocator>::balancear(
+    typename ListaIndexada<Type, Allocator>::Node* node) {
+  atualizar(node);
+  int fator = fatorBalanceamento(node);
+
+  if (fator > 1) {  // Pesado à esquerda
+    if (fatorBalanceamento(node->left) < 0) {
+      ligarEsquerdo(node, rotacaoEsquerda(node->left));  // Caso esquerda-direita
+    }
+    return rotacaoDireita(node);
+  }
+
+  if (fator < -1) {  // Pesado à direita
+    if (fatorBalanceamento(node->right) > 0) {
+      ligarDireito(node, rotacaoDireita(node->right));  // Caso direita-esquerda
+    }
+    return rotacaoEsquerda(node);
+  }
+
+  return node;
+}
+
+template <typename Type, typename Allocator>
+typename ListaIndexada<Type, Allocator>::Node* ListaIndexada<Type, Allocator>::inserir(
+    typename ListaIndexada<Type, Allocator>::Node* node, size_t posicao,
+    typename ListaIndexada<Type, Allocator>::Node* novo) {
+  if (node == nullptr) return novo;
+
+  // As posições até o tamanho da subárvore esquerda ficam à esquerda do nó
+  size_t esquerda = tamanho(node->left);
+  if (posicao <= esquerda) {
+    ligarEsquerdo(node, inserir(node->left, posicao, novo));
+  } else {
+    ligarDireito(node, inserir(node->right, posicao - esquerda - 1, novo));
+  }
+
+  return balancear(node);
+}
+
+template <typename Type, typename Allocator>
+typename ListaIndexada<Type, Allocator>::Node* ListaIndexada<Type, Allocator>::remover(
+    typename ListaIndexada<Type, Allocator>::Node* node, size_t posicao,
+    typename ListaIndexada<Type, Allocator>::Node*& removido) {
+  size_t esquerda = tamanho(node->left);
+
+  if (posicao < esquerda) {
+    ligarEsquerdo(node, remover(node->left, posicao, removido));
+  } else if (posicao > esquerda) {
+    ligarDireito(node, remover(node->right, posicao - esquerda - 1, removido));
+  } else {
+    removido = node;
+
+    if (node->left == nullptr || node->right == nullptr) {
+      Node* filho = node->left != nullptr ? node->left : node->right;
+      if (filho != nullptr) filho->pai = node->pai;
+      return filho;
+    }
+
+    // Dois filhos: o sucessor (menor nó da subárvore direita) ocupa o lugar do nó removido
+    Node* sucessor;
+    Node* direito = removerMinimo(node->right, sucessor);
+    sucessor->pai = node->pai;
+    ligarEsquerdo(sucessor, node->left);
+    ligarDireito(sucessor, direito);
+    return balancear(sucessor);
+  }
+
+  return balancear(node);
+}
+
+template <typename Type, typename Allocator>
+typename ListaIndexada<Type, Allocator>::Node* ListaIndexada<Type, Allocator>::removerMinimo(
+    typename ListaIndexada<Type, Allocator>::Node* node,
+    typename ListaIndexada<Type, Allocator>::Node*& minimo) {
+  if (node->left == nullptr) {
+    minimo = node;
+    if (node->right != nullptr) node->right->pai = node->pai;
+    return node->right;
+  }
+
+  ligarEsquerdo(node, removerMinimo(node->left, minimo));
+  return balancear(node);
+}
+
+template <typename Type, typename Allocator>
+typename ListaIndexada<Type, Allocator>::Node* ListaIndexada<Type, Allocator>::localizar(
+    size_t posicao) const {
+  Node* atual = raiz;
+
+  while (true) {
+    size_t esquerda = tamanho(atual->left);
+    if (posicao == esquerda) return atual;
+
+    if (posicao < esquerda) {
+      atual = atual->left;
+    } else {
+      posicao -= esquerda + 1;
+      atual = atual->right;
+    }
+  }
+}
+
+template <typename Type, typename Allocator>
+void ListaIndexada<Type, Allocator>::insert(Type dado, size_t posicao) {
+  if (posicao > size()) {
+    throw std::out_of_range("Posicao invalida (maior que o tamanho da lista)");
+  }
+
+  raiz = inserir(raiz, posicao, criarNo(dado));
+  raiz->pai = nullptr;
+}
+
+template <typename Type, typename Allocator>
+void ListaIndexada<Type, Allocator>::remove(size_t posicao) {
+  if (posicao >= size()) {
+    throw std::out_of_range("Posicao invalida (maior ou igual ao tamanho da lista)");
+  }
+
+  Node* removido;
+  raiz = remover(raiz, posicao, removido);
+  if (raiz != nullptr) raiz->pai = nullptr;
+
+  liberarNo(removido);
+}
+
+template <typename Type, typename Allocator>
+void ListaIndexada<Type, Allocator>::pop_front() {
+  if (isEmpty()) {
+    throw std::out_of_range("A lista esta vazia!");
+  }
+
+  remove(0);
+}
+
+template <typename Type, typename Allocator>
+void ListaIndexada<Type, Allocator>::pop_back() {
+  if (isEmpty()) {
+    throw std::out_of_range("A lista esta vazia!");
+  }
+
+  remove(size() - 1);
+}
+
+template <typename Type, typename Allocator>
+void ListaIndexada<Type, Allocator>::push_front(Type dado) {
+  insert(dado, 0);
+}
+
+template <typename Type, typename Allocator>
+void ListaIndexada<Type, Allocator>::push_back(Type dado) {
+  insert(dado, size());
+}
+
+template <typename Type, typename Allocator>
+Type& ListaIndexada<Type, Allocator>::at(size_t posicao) {
+  if (posicao >= size()) {
+    throw std::out_of_range("Posicao invalida (maior ou igual ao tamanho da lista)");
+  }
+
+  return localizar(posicao)->valor;
+}
+
+template <typename Type, typename Allocator>
+const Type& ListaIndexada<Type, Allocator>::at(size_t posicao) const {
+  if (posicao >= size()) {
+    throw std::out_of_range("Posicao invalida (maior ou igual ao tamanho da lista)");
+  }
+
+  return localizar(posicao)->valor;
+}
+
+template <typename Type, typename Allocator>
+void ListaIndexada<Type, Allocator>::clear() {
+  // Com uma arena e valores de destrutor trivial, os nós são abandonados sem serem percorridos
+  if (!DescarteSemPercurso<Allocator, Type>::value) {
+    destruir(raiz);
+  }
+
+  raiz = nullptr;
+}
+
+template <typename Type, typename Allocator>
+void ListaIndexada<Type, Allocator>::inverter(typename ListaIndexada<Type, Allocator>::Node* node) {
+  if (node == nullptr) return;
+
+  std::swap(node->left, node->right);
+  inverter(node->left);
+  inverter(node->right);
+}
+
+template <typename Type, typename Allocator>
+void ListaIndexada<Type, Allocator>::reverse() {
+  inverter(raiz);
+}
+
+template <typename Type, typename Allocator>
+void ListaIndexada<Type, Allocator>::print() {
+  if (isEmpty()) {
+    std::cout << "A lista esta vazia!" << std::endl;
+    return;
+  }
+
+  // Percorre e imprime os elementos da lista
+  for (const Type& valor : *this) {
+    std::cout << valor << " ";
+  }
+
+  std::cout << std::endl;
+}
+
+template <typename Type, typename Allocator>
+size_t ListaIndexada<Type, Allocator>::size() const {
+  return tamanho(raiz);
+}
+
+template <typename Type, typename Allocator>
+size_t ListaIndexada<Type, Allocator>::memoryUsage() const {
+  return size() * sizeof(Node);
+}
+
+template <typename Type, typename Allocator>
+bool ListaIndexada<Type, Allocator>::isEmpty() const {
+  return raiz == nullptr;
+}
+
+template <typename Type, typename Allocator>
+size_t ListaIndexada<Type, Allocator>::height() const {
+  return static_cast<size_t>(altura(raiz));
+}
+
+template <typename Type, typename Allocator>
+typename ListaIndexada<Type, Allocator>::const_iterator&
+ListaIndexada<Type, Allocator>::const_iterator::operator++() {
+  if (node->right != nullptr) {
+    // O sucessor é o nó mais à esquerda da subárvore direita
+    node = node->right;
+    while (node->left != nullptr) node = node->left;
+    return *this;
+  }
+
+  // Sobe enquanto o nó for filho direito; o sucessor é o primeiro ancestral à direita
+  const Node* filho = node;
+  node = node->pai;
+  while (node != nullptr && node->right == filho) {
+    filho = node;
+    node = node->pai;
+  }
+  return *this;
+}
+
+template <typename Type, typename Allocator>
+typename ListaIndexada<Type, Allocator>::const_iterator
+ListaIndexada<Type, Allocator>::const_iterator::operator++(int) {
+  const_iterator anterior = *this;
+  ++*this;
+  return anterior;
+}
+
+template <typename Type, typename Allocator>
+typename ListaIndexada<Type, Allocator>::const_iterator ListaIndexada<Type, Allocator>::begin()
+    const {
+  const Node* node = raiz;
+  if (node != nullptr) {
+    while (node->left != nullptr) node = node->left;
+  }
+  return const_iterator(node);
+}
+
+template <typename Type, typename Allocator>
+typename ListaIndexada<Type, Allocator>::const_iterator ListaIndexada<Type, Allocator>::end()
+    const {
+  return const_iterator(nullptr);
+}
+
+template <typename Type, typename Allocator>
+Allocator ListaIndexada<Type, Allocator>::get_allocator() const {
+  return Allocator(alocador);
+}
+
+#endif
@@ -0,0 +1,449 @@
+#ifndef LISTA_INTRUSIVA_HPP
+#define LISTA_INTRUSIVA_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+
+#include "Gancho.hpp"
+
+/**
+ * @brief Lista duplamente ligada intrusiva
+ *
+ * Guarda objetos que herdam `Gancho<Marca>` ligando os ganchos deles, sem alocar nem copiar nada:
+ * a lista não é dona dos objetos, que precisam viver enquanto estiverem ligados. Como na
+ * `ListaDupla`, a lista é circular em torno de uma sentinela, então ligar e desligar qualquer
+ * objeto é O(1).
+ *
+ * Desligar (`erase`, `pop_front`, `pop_back`) um objeto que não está nesta lista tem comportamento
+ * indefinido. Sem `NDEBUG`, um `assert` detecta objetos desligados ou ligados por este gancho a
+ * uma `FilaIntrusiva`/`PilhaIntrusiva`, mas não objetos que estão em outra `ListaIntrusiva`.
+ *
+ * @tparam Type Tipo dos objetos, que precisa herdar `Gancho<Marca>`
+ * @tparam Marca Marca do gancho usado por esta lista
+ */
+template <typename Type, typename Marca = void>
+class ListaIntrusiva {
+ private:
+  using GanchoLista = Gancho<Marca>;
+
+  /**
+   * @brief Sentinela: `sentinela.proximo` é o primeiro gancho e `sentinela.anterior` o último
+   *
+   */
+  GanchoLista sentinela;
+
+  /**
+   * @brief Número de objetos na lista
+   *
+   */
+  size_t tamanho;
+
+ public:
+  class const_iterator;
+
+  /**
+   * @brief Iterador bidirecional sobre os objetos da lista
+   *
+   */
+  class iterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Type*;
+    using reference = Type&;
+
+    iterator() : gancho(nullptr) {}
+
+    reference operator*() const { return static_cast<Type&>(*gancho); }
+    pointer operator->() const { return &static_cast<Type&>(*gancho); }
+
+    iterator& operator++() {
+      gancho = gancho->proximo;
+      return *this;
+    }
+
+    iterator operator++(int) {
+      iterator anterior = *this;
+      gancho = gancho->proximo;
+      return anterior;
+    }
+
+    iterator& operator--() {
+      gancho = gancho->anterior;
+      return *this;
+    }
+
+    iterator operator--(int) {
+      iterator posterior = *this;
+      gancho = gancho->anterior;
+      return posterior;
+    }
+
+    bool operator==(const iterator& outro) const { return gancho == outro.gancho; }
+    bool operator!=(const iterator& outro) const { return gancho != outro.gancho; }
+
+   private:
+    /**
+     * @brief Gancho atual (a sentinela representa o fim)
+     *
+     */
+    GanchoLista* gancho;
+
+    explicit iterator(GanchoLista* gancho) : gancho(gancho) {}
+
+    friend class const_iterator;
+    friend class ListaIntrusiva<Type, Marca>;
+  };
+
+  /**
+   * @brief Iterador bidirecional (somente leitura) sobre os objetos da lista
+   *
+   */
+  class const_iterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Type*;
+    using reference = const Type&;
+
+    const_iterator() : gancho(nullptr) {}
+    const_iterator(const iterator& outro) : gancho(outro.gancho) {}
+
+    reference operator*() const { return static_cast<const Type&>(*gancho); }
+    pointer operator->() const { return &static_cast<const Type&>(*gancho); }
+
+    const_iterator& operator++() {
+      gancho = gancho->proximo;
+      return *this;
+    }
+
+    const_iterator operator++(int) {
+      const_iterator anterior = *this;
+      gancho = gancho->proximo;
+      return anterior;
+    }
+
+    const_iterator& operator--() {
+      gancho = gancho->anterior;
+      return *this;
+    }
+
+    const_iterator operator--(int) {
+      const_iterator posterior = *this;
+      gancho = gancho->anterior;
+      return posterior;
+    }
+
+    bool operator==(const const_iterator& outro) const { return gancho == outro.gancho; }
+    bool operator!=(const const_iterator& outro) const { return gancho != outro.gancho; }
+
+   private:
+    /**
+     * @brief Gancho atual (a sentinela representa o fim)
+     *
+     */
+    const GanchoLista* gancho;
+
+    explicit const_iterator(const GanchoLista* gancho) : gancho(gancho) {}
+
+    friend class ListaIntrusiva<Type, Marca>;
+  };
+
+  ListaIntrusiva();
+  ListaIntrusiva(const ListaIntrusiva<Type, Marca>&) = delete;
+  ListaIntrusiva<Type, Marca>& operator=(const ListaIntrusiva<Type, Marca>&) = delete;
+  // Destrutor (implementado mais abaixo): desliga os objetos, sem destruí-los
+  ~ListaIntrusiva();
+
+  /**
+   * @brief Liga um objeto no início da lista, em O(1)
+   *
+   * @param objeto Objeto que ainda não está ligado por este gancho
+   */
+  void push_front(Type& objeto);
+
+  /**
+   * @brief Liga um objeto no final da lista, em O(1)
+   *
+   * @param objeto Objeto que ainda não está ligado por este gancho
+   */
+  void push_back(Type& objeto);
+
+  /**
+   * @brief Desliga o primeiro objeto da lista, em O(1)
+   *
+   * @throw `std::out_of_range` se a lista estiver vazia
+   */
+  void pop_front();
+
+  /**
+   * @brief Desliga o último objeto da lista, em O(1)
+   *
+   * @throw `std::out_of_range` se a lista estiver vazia
+   */
+  void pop_back();
+
+  /**
+   * @brief Retorna o primeiro objeto da lista
+   *
+   * @throw `std::out_of_range` se a lista estiver vazia
+   */
+  Type& front();
+
+  /**
+   * @brief Retorna o último objeto da lista
+   *
+   * @throw `std::out_of_range` se a lista estiver vazia
+   */
+  Type& back();
+
+  /**
+   * @brief Liga um objeto antes de `posicao`, em O(1)
+   *
+   * @param posicao Iterador que ficará depois do objeto (`end()` liga no final)
+   * @param objeto Objeto que ainda não está ligado por este gancho
+   * @return iterator Iterador do objeto ligado
+   */
+  iterator insert(const_iterator posicao, Type& objeto);
+
+  /**
+   * @brief Desliga o objeto de `posicao`, em O(1)
+   *
+   * @param posicao Iterador de um objeto da lista (não pode ser `end()`)
+   * @return iterator Iterador do objeto seguinte
+   */
+  iterator erase(const_iterator posicao);
+
+  /**
+   * @brief Desliga um objeto que está nesta lista, em O(1)
+   *
+   * @param objeto Objeto ligado a esta lista (se ele estiver em outra lista, o comportamento é
+   * indefinido)
+   */
+  void erase(Type& objeto);
+
+  /**
+   * @brief Retorna o iterador de um objeto que está nesta lista, em O(1)
+   *
+   */
+  iterator iterator_to(Type& objeto);
+
+  /**
+   * @brief Desliga todos os objetos da lista (os objetos não são destruídos)
+   *
+   */
+  void clear();
+
+  /**
+   * @brief Retorna o número de objetos na lista
+   *
+   * @return size_t
+   */
+  size_t size() const;
+
+  /**
+   * @brief Retorna se a lista está ou não vazia
+   *
+   */
+  bool isEmpty() const;
+
+  /**
+   * @brief Retorna um iterador para o primeiro objeto
+   *
+   */
+  iterator begin();
+  const_iterator begin() const;
+
+  /**
+   * @brief Retorna o iterador que representa o fim da lista (a sentinela)
+   *
+   */
+  iterator end();
+  const_iterator end() const;
+
+ private:
+  /**
+   * @brief Liga `gancho` antes de `posicao`
+   *
+   */
+  void ligar(GanchoLista* posicao, GanchoLista* gancho);
+
+  /**
+   * @brief Desliga `gancho` dos vizinhos e anula os ponteiros dele
+   *
+   */
+  void desligar(GanchoLista* gancho);
+};
+
+template <typename Type, typename Marca>
+ListaIntrusiva<Type, Marca>::ListaIntrusiva() : tamanho(0) {
+  sentinela.anterior = &sentinela;
+  sentinela.proximo = &sentinela;
+}
+
+template <typename Type, typename Marca>
+ListaIntrusiva<Type, Marca>::~ListaIntrusiva() {
+  clear();
+
+  // A sentinela também é um gancho, e não pode ser destruída ligada (a ela mesma)
+  sentinela.anterior = nullptr;
+  sentinela.proximo = nullptr;
+}
+
+template <typename Type, typename Marca>
+void ListaIntrusiva<Type, Marca>::ligar(typename ListaIntrusiva<Type, Marca>::GanchoLista* posicao,
+                                        typename ListaIntrusiva<Type, Marca>::GanchoLista* gancho) {
+  assert(!gancho->ligado() && "O objeto ja esta ligado a um container");
+
+  gancho->anterior = posicao->anterior;
+  gancho->proximo = posicao;
+  posicao->anterior->proximo = gancho;
+  posicao->anterior = gancho;
+
+  ++tamanho;
+}
+
+template <typename Type, typename Marca>
+void ListaIntrusiva<Type, Marca>::desligar(
+    typename ListaIntrusiva<Type, Marca>::GanchoLista* gancho) {
+  // Verifica apenas que o gancho está em alguma lista duplamente ligada: nas filas e pilhas
+  // intrusivas `anterior` é nulo, mas descobrir se a lista é esta mesma custaria O(n)
+  assert(gancho != &sentinela && gancho->anterior != nullptr &&
+         gancho->anterior->proximo == gancho &&
+         "O objeto nao esta ligado a uma ListaIntrusiva por este gancho");
+
+  gancho->anterior->proximo = gancho->proximo;
+  gancho->proximo->anterior = gancho->anterior;
+  gancho->anterior = nullptr;
+  gancho->proximo = nullptr;
+
+  --tamanho;
+}
+
+template <typename Type, typename Marca>
+void ListaIntrusiva<Type, Marca>::push_front(Type& objeto) {
+  ligar(sentinela.proximo, &static_cast<GanchoLista&>(objeto));
+}
+
+template <typename Type, typename Marca>
+void ListaIntrusiva<Type, Marca>::push_back(Type& objeto) {
+  ligar(&sentinela, &static_cast<GanchoLista&>(objeto));
+}
+
+template <typename Type, typename Marca>
+void ListaIntrusiva<Type, Marca>::pop_front() {
+  if (tamanho == 0) {
+    throw std::out_of_range("A lista esta vazia!");
+  }
+
+  desligar(sentinela.proximo);
+}
+
+template <typename Type, typename Marca>
+void ListaIntrusiva<Type, Marca>::pop_back() {
+  if (tamanho == 0) {
+    throw std::out_of_range("A lista esta vazia!");
+  }
+
+  desligar(sentinela.anterior);
+}
+
+template <typename Type, typename Marca>
+Type& ListaIntrusiva<Type, Marca>::front() {
+  if (tamanho == 0) {
+    throw std::out_of_range("A lista esta vazia!");
+  }
+
+  return static_cast<Type&>(*sentinela.proximo);
+}
+
+template <typename Type, typename Marca>
+Type& ListaIntrusiva<Type, Marca>::back() {
+  if (tamanho == 0) {
+    throw std::out_of_range("A lista esta vazia!");
+  }
+
+  return static_cast<Type&>(*sentinela.anterior);
+}
+
+template <typename Type, typename Marca>
+typename ListaIntrusiva<Type, Marca>::iterator ListaIntrusiva<Type, Marca>::insert(
+    typename ListaIntrusiva<Type, Marca>::const_iterator posicao, Type& objeto) {
+  GanchoLista* gancho = &static_cast<GanchoLista&>(objeto);
+  ligar(const_cast<GanchoLista*>(posicao.gancho), gancho);
+
+  return iterator(gancho);
+}
+
+template <typename Type, typename Marca>
+typename ListaIntrusiva<Type, Marca>::iterator ListaIntrusiva<Type, Marca>::erase(
+    typename ListaIntrusiva<Type, Marca>::const_iterator posicao) {
+  GanchoLista* gancho = const_cast<GanchoLista*>(posicao.gancho);
+  GanchoLista* posterior = gancho->proximo;
+  desligar(gancho);
+
+  return iterator(posterior);
+}
+
+template <typename Type, typename Marca>
+void ListaIntrusiva<Type, Marca>::erase(Type& objeto) {
+  desligar(&static_cast<GanchoLista&>(objeto));
+}
+
+template <typename Type, typename Marca>
+typename ListaIntrusiva<Type, Marca>::iterator ListaIntrusiva<Type, Marca>::iterator_to(
+    Type& objeto) {
+  return iterator(&static_cast<GanchoLista&>(objeto));
+}
+
+template <typename Type, typename Marca>
+void ListaIntrusiva<Type, Marca>::clear() {
+  // Os ganchos são anulados para que os objetos possam ser ligados de novo (ou destruídos)
+  GanchoLista* atual = sentinela.proximo;
+  while (atual != &sentinela) {
+    GanchoLista* posterior = atual->proximo;
+    atual->anterior = nullptr;
+    atual->proximo = nullptr;
+    atual = posterior;
+  }
+
+  sentinela.anterior = &sentinela;
+  sentinela.proximo = &sentinela;
+  tamanho = 0;
+}
+
+template <typename Type, typename Marca>
+size_t ListaIntrusiva<Type, Marca>::size() const {
+  return tamanho;
+}
+
+template <typename Type, typename Marca>
+bool ListaIntrusiva<Type, Marca>::isEmpty() const {
+  return tamanho == 0;
+}
+
+template <typename Type, typename Marca>
+typename ListaIntrusiva<Type, Marca>::iterator ListaIntrusiva<Type, Marca>::begin() {
+  return iterator(sentinela.proximo);
+}
+
+template <typename Type, typename Marca>
+typename ListaIntrusiva<Type, Marca>::const_iterator ListaIntrusiva<Type, Marca>::begin() const {
+  return const_iterator(sentinela.proximo);
+}
+
+template <typename Type, typename Marca>
+typename ListaIntrusiva<Type, Marca>::iterator ListaIntrusiva<Type, Marca>::end() {
+  return iterator(&sentinela);
+}
+
+template <typename Type, typename Marca>
+typename ListaIntrusiva<Type, Marca>::const_iterator ListaIntrusiva<Type, Marca>::end() const {
+  return const_iterator(&sentinela);
+}
+
+#endif
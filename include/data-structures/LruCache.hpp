@@ -0,0 +1,496 @@
+#ifndef LRU_CACHE_HPP
+#define LRU_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+#include "ListaDupla.hpp"
+
+/**
+ * @brief Política de substituição do `LruCache`
+ *
+ */
+enum class PoliticaCache {
+  /**
+   * @brief Remove sempre a entrada usada há mais tempo
+   *
+   */
+  LRU,
+
+  /**
+   * @brief LRU segmentado: entradas novas ficam em um segmento de experiência e só passam ao
+   * segmento protegido (80% da capacidade) quando são lidas de novo, então uma varredura de chaves
+   * usadas uma única vez não expulsa as chaves quentes
+   *
+   */
+  SLRU
+};
+
+/**
+ * @brief Cache de tamanho limitado com substituição LRU (ou SLRU)
+ *
+ * A ordem de uso fica em listas `ListaDupla`, da entrada mais recente (início) para a mais antiga
+ * (final), e um índice hash de endereçamento aberto (sondagem linear) guarda o handle de cada
+ * entrada. Assim `get`, `put` e `erase` são O(1) em média: a busca é feita no índice e a
+ * atualização da ordem é só religar um nó.
+ *
+ * O índice tem tamanho fixo (uma potência de 2 com pelo menos o dobro da capacidade), então nunca
+ * precisa ser redimensionado, e as remoções usam deslocamento para trás em vez de marcadores.
+ *
+ * Uma entrada é despejada quando a quantidade de entradas passa da capacidade ou quando a soma dos
+ * bytes declarados em `put` passa do orçamento de bytes.
+ *
+ * @tparam Key
+ * @tparam Value
+ * @tparam Hash Função hash das chaves
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class LruCache {
+ private:
+  struct Entrada {
+    Key chave;
+    Value valor;
+
+    /**
+     * @brief Bytes declarados para a entrada (contam para o orçamento)
+     *
+     */
+    size_t bytes;
+
+    /**
+     * @brief Hash já misturado da chave, guardado para não recalcular nas remoções
+     *
+     */
+    size_t hash;
+
+    /**
+     * @brief Se a entrada está no segmento protegido (apenas em SLRU)
+     *
+     */
+    bool protegida;
+  };
+
+  using Segmento = ListaDupla<Entrada>;
+  using Handle = typename Segmento::iterator;
+
+  struct Slot {
+    size_t hash;
+    Handle entrada;
+    bool ocupado;
+  };
+
+  std::vector<Slot> indice;
+  size_t mascara;
+
+  /**
+   * @brief Entradas em experiência (em LRU, todas as entradas ficam aqui)
+   *
+   */
+  Segmento experiencia;
+
+  /**
+   * @brief Entradas lidas mais de uma vez (apenas em SLRU)
+   *
+   */
+  Segmento protegido;
+
+  size_t capacidade;
+  size_t capacidadeProtegida;
+  size_t orcamentoBytes;
+  size_t bytesUsados;
+  PoliticaCache politica;
+
+  size_t acertos;
+  size_t faltas;
+  size_t despejos;
+
+ public:
+  /**
+   * @brief Cria o cache vazio
+   *
+   * @param capacidade Quantidade máxima de entradas
+   * @param orcamentoBytes Soma máxima dos bytes das entradas (0 para não limitar)
+   * @param politica Política de substituição
+   *
+   * @throw `std::invalid_argument` se a capacidade for 0
+   */
+  explicit LruCache(size_t capacidade, size_t orcamentoBytes = 0,
+                    PoliticaCache politica = PoliticaCache::LRU);
+  LruCache(const LruCache<Key, Value, Hash>&) = delete;
+  LruCache<Key, Value, Hash>& operator=(const LruCache<Key, Value, Hash>&) = delete;
+
+  /**
+   * @brief Busca o valor de uma chave e a marca como usada agora
+   *
+   * Conta um acerto ou uma falta.
+   *
+   * @param chave Chave buscada
+   * @return Value* Ponteiro para o valor (válido até a próxima modificação do cache), ou `nullptr`
+   * se a chave não estiver no cache
+   */
+  Value* get(const Key& chave);
+
+  /**
+   * @brief Insere ou atualiza o valor de uma chave e a marca como usada agora
+   *
+   * Despeja as entradas menos recentes até a capacidade e o orçamento de bytes serem respeitados.
+   * Atualizar uma chave não a promove ao segmento protegido em SLRU: a entrada só vai para o início
+   * do segmento em que já está.
+   *
+   * @param chave Chave da entrada
+   * @param valor Valor da entrada
+   * @param bytes Bytes que a entrada ocupa, para o orçamento de bytes
+   * @return true se a entrada foi guardada; false se ela sozinha passa do orçamento de bytes (nesse
+   * caso uma entrada antiga da mesma chave também é removida)
+   */
+  bool put(const Key& chave, Value valor, size_t bytes = sizeof(Key) + sizeof(Value));
+
+  /**
+   * @brief Remove a entrada de uma chave
+   *
+   * @return true se a chave estava no cache
+   */
+  bool erase(const Key& chave);
+
+  /**
+   * @brief Retorna se a chave está no cache, sem alterar a ordem de uso nem os contadores
+   *
+   */
+  bool contains(const Key& chave) const;
+
+  /**
+   * @brief Remove todas as entradas (os contadores são mantidos)
+   *
+   */
+  void clear();
+
+  /**
+   * @brief Retorna o número de entradas no cache
+   *
+   * @return size_t
+   */
+  size_t size() const;
+
+  /**
+   * @brief Retorna a quantidade máxima de entradas
+   *
+   * @return size_t
+   */
+  size_t capacity() const;
+
+  /**
+   * @brief Retorna a soma dos bytes das entradas no cache
+   *
+   * @return size_t
+   */
+  size_t bytes() const;
+
+  /**
+   * @brief Retorna quantas chamadas de `get` encontraram a chave
+   *
+   * @return size_t
+   */
+  size_t hits() const;
+
+  /**
+   * @brief Retorna quantas chamadas de `get` não encontraram a chave
+   *
+   * @return size_t
+   */
+  size_t misses() const;
+
+  /**
+   * @brief Retorna quantas entradas foram despejadas para abrir espaço
+   *
+   * @return size_t
+   */
+  size_t evictions() const;
+
+  /**
+   * @brief Zera os contadores de acertos, faltas e despejos
+   *
+   */
+  void resetStats();
+
+ private:
+  /**
+   * @brief Espalha os bits do hash, já que `std::hash` de inteiros costuma ser a identidade
+   *
+   */
+  static size_t misturar(size_t hash);
+
+  /**
+   * @brief Retorna o slot da chave no índice, ou `indice.size()` se ela não estiver no cache
+   *
+   */
+  size_t localizar(const Key& chave, size_t hash) const;
+
+  /**
+   * @brief Retorna o slot que guarda o handle de uma entrada (que precisa estar no cache)
+   *
+   */
+  size_t localizarEntrada(Handle entrada) const;
+
+  /**
+   * @brief Esvazia um slot e desloca para trás as entradas seguintes do mesmo agrupamento
+   *
+   */
+  void liberarSlot(size_t slot);
+
+  /**
+   * @brief Remove uma entrada das listas e do índice
+   *
+   */
+  void removerEntrada(size_t slot);
+
+  /**
+   * @brief Move uma entrada lida para o início do seu segmento, promovendo-a em SLRU
+   *
+   */
+  void usar(Handle entrada);
+
+  /**
+   * @brief Despeja entradas até a capacidade e o orçamento de bytes serem respeitados
+   *
+   * @param preservada Entrada recém-usada, que nunca é escolhida como vítima
+   */
+  void despejar(Handle preservada);
+};
+
+template <typename Key, typename Value, typename Hash>
+LruCache<Key, Value, Hash>::LruCache(size_t capacidade, size_t orcamentoBytes,
+                                     PoliticaCache politica)
+    : capacidade(capacidade),
+      capacidadeProtegida(capacidade - capacidade / 5),
+      orcamentoBytes(orcamentoBytes),
+      bytesUsados(0),
+      politica(politica),
+      acertos(0),
+      faltas(0),
+      despejos(0) {
+  if (capacidade == 0) {
+    throw std::invalid_argument("A capacidade do cache deve ser maior que zero");
+  }
+
+  // Durante um `put` o índice chega a ter `capacidade + 1` entradas; com no máximo metade dos
+  // slots ocupados, as sequências de sondagem ficam curtas e sempre terminam em um slot vazio
+  size_t slots = 4;
+  while (slots < 2 * (capacidade + 1)) slots *= 2;
+
+  indice.assign(slots, Slot{0, Handle(), false});
+  mascara = slots - 1;
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t LruCache<Key, Value, Hash>::misturar(size_t hash) {
+  uint64_t x = static_cast<uint64_t>(hash);
+  x ^= x >> 33;
+  x *= 0xff51afd7ed558ccdull;
+  x ^= x >> 33;
+  return static_cast<size_t>(x);
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t LruCache<Key, Value, Hash>::localizar(const Key& chave, size_t hash) const {
+  for (size_t slot = hash & mascara;; slot = (slot + 1) & mascara) {
+    const Slot& atual = indice[slot];
+    if (!atual.ocupado) return indice.size();
+    if (atual.hash == hash && atual.entrada->chave == chave) return slot;
+  }
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t LruCache<Key, Value, Hash>::localizarEntrada(
+    typename LruCache<Key, Value, Hash>::Handle entrada) const {
+  size_t slot = entrada->hash & mascara;
+  while (indice[slot].entrada != entrada) slot = (slot + 1) & mascara;
+  return slot;
+}
+
+template <typename Key, typename Value, typename Hash>
+void LruCache<Key, Value, Hash>::liberarSlot(size_t slot) {
+  // Cada entrada seguinte que não ficaria mais alcançável a partir do seu slot ideal (porque a
+  // sondagem pararia no buraco) é puxada para o buraco, que anda para a posição dela
+  size_t buraco = slot;
+  for (size_t atual = (slot + 1) & mascara; indice[atual].ocupado;
+       atual = (atual + 1) & mascara) {
+    size_t ideal = indice[atual].hash & mascara;
+
+    // Distâncias (circulares) do slot ideal até o buraco e até a posição atual
+    if (((buraco - ideal) & mascara) < ((atual - ideal) & mascara)) {
+      indice[buraco] = indice[atual];
+      buraco = atual;
+    }
+  }
+
+  indice[buraco].ocupado = false;
+  indice[buraco].entrada = Handle();
+}
+
+template <typename Key, typename Value, typename Hash>
+void LruCache<Key, Value, Hash>::removerEntrada(size_t slot) {
+  Handle entrada = indice[slot].entrada;
+  bytesUsados -= entrada->bytes;
+
+  if (entrada->protegida) {
+    protegido.erase(entrada);
+  } else {
+    experiencia.erase(entrada);
+  }
+
+  liberarSlot(slot);
+}
+
+template <typename Key, typename Value, typename Hash>
+void LruCache<Key, Value, Hash>::usar(typename LruCache<Key, Value, Hash>::Handle entrada) {
+  if (entrada->protegida) {
+    protegido.move_to_front(entrada);
+    return;
+  }
+
+  if (politica == PoliticaCache::LRU) {
+    experiencia.move_to_front(entrada);
+    return;
+  }
+
+  // Em SLRU, a segunda leitura promove a entrada; se o segmento protegido encher, a entrada
+  // protegida mais antiga volta para o início do segmento de experiência
+  protegido.splice(protegido.begin(), experiencia, entrada);
+  entrada->protegida = true;
+
+  if (protegido.size() > capacidadeProtegida) {
+    Handle rebaixada = --protegido.end();
+    experiencia.splice(experiencia.begin(), protegido, rebaixada);
+    rebaixada->protegida = false;
+  }
+}
+
+template <typename Key, typename Value, typename Hash>
+void LruCache<Key, Value, Hash>::despejar(typename LruCache<Key, Value, Hash>::Handle preservada) {
+  while (size() > capacidade || (orcamentoBytes != 0 && bytesUsados > orcamentoBytes)) {
+    // A vítima é a entrada mais antiga do segmento de experiência, ou do protegido se sobrar só a
+    // entrada preservada (que cabe sozinha, então o laço termina antes de chegar a ela)
+    Handle vitima = experiencia.isEmpty() ? Handle() : --experiencia.end();
+    if (vitima == Handle() || vitima == preservada) vitima = --protegido.end();
+
+    removerEntrada(localizarEntrada(vitima));
+    ++despejos;
+  }
+}
+
+template <typename Key, typename Value, typename Hash>
+Value* LruCache<Key, Value, Hash>::get(const Key& chave) {
+  size_t slot = localizar(chave, misturar(Hash()(chave)));
+  if (slot == indice.size()) {
+    ++faltas;
+    return nullptr;
+  }
+
+  ++acertos;
+  Handle entrada = indice[slot].entrada;
+  usar(entrada);
+  return &entrada->valor;
+}
+
+template <typename Key, typename Value, typename Hash>
+bool LruCache<Key, Value, Hash>::put(const Key& chave, Value valor, size_t bytes) {
+  size_t hash = misturar(Hash()(chave));
+  size_t slot = localizar(chave, hash);
+
+  if (orcamentoBytes != 0 && bytes > orcamentoBytes) {
+    // A entrada nunca caberia; a versão antiga da chave também sai, para não ficar desatualizada
+    if (slot != indice.size()) removerEntrada(slot);
+    return false;
+  }
+
+  Handle entrada;
+  if (slot != indice.size()) {
+    entrada = indice[slot].entrada;
+    entrada->valor = valor;
+    bytesUsados = bytesUsados - entrada->bytes + bytes;
+    entrada->bytes = bytes;
+
+    // Só leituras promovem em SLRU, então uma escrita repetida não expulsa as entradas protegidas
+    if (entrada->protegida) {
+      protegido.move_to_front(entrada);
+    } else {
+      experiencia.move_to_front(entrada);
+    }
+  } else {
+    // Entradas novas começam no segmento de experiência, tanto em LRU quanto em SLRU
+    experiencia.push_front(Entrada{chave, valor, bytes, hash, false});
+    bytesUsados += bytes;
+
+    slot = hash & mascara;
+    while (indice[slot].ocupado) slot = (slot + 1) & mascara;
+    entrada = experiencia.begin();
+    indice[slot] = Slot{hash, entrada, true};
+  }
+
+  despejar(entrada);
+  return true;
+}
+
+template <typename Key, typename Value, typename Hash>
+bool LruCache<Key, Value, Hash>::erase(const Key& chave) {
+  size_t slot = localizar(chave, misturar(Hash()(chave)));
+  if (slot == indice.size()) return false;
+
+  removerEntrada(slot);
+  return true;
+}
+
+template <typename Key, typename Value, typename Hash>
+bool LruCache<Key, Value, Hash>::contains(const Key& chave) const {
+  return localizar(chave, misturar(Hash()(chave))) != indice.size();
+}
+
+template <typename Key, typename Value, typename Hash>
+void LruCache<Key, Value, Hash>::clear() {
+  experiencia.clear();
+  protegido.clear();
+  indice.assign(indice.size(), Slot{0, Handle(), false});
+  bytesUsados = 0;
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t LruCache<Key, Value, Hash>::size() const {
+  return experiencia.size() + protegido.size();
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t LruCache<Key, Value, Hash>::capacity() const {
+  return capacidade;
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t LruCache<Key, Value, Hash>::bytes() const {
+  return bytesUsados;
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t LruCache<Key, Value, Hash>::hits() const {
+  return acertos;
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t LruCache<Key, Value, Hash>::misses() const {
+  return faltas;
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t LruCache<Key, Value, Hash>::evictions() const {
+  return despejos;
+}
+
+template <typename Key, typename Value, typename Hash>
+void LruCache<Key, Value, Hash>::resetStats() {
+  acertos = 0;
+  faltas = 0;
+  despejos = 0;
+}
+
+#endif
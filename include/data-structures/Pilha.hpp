@@ -2,9 +2,18 @@
 #define PILHA_HPP
 
 #include <iostream>
+#include <memory>
 #include <stdexcept>
 
-template <typename Type>
+#include "../allocators/AlocadorMonotonico.hpp"
+
+/**
+ * @brief Pilha encadeada
+ *
+ * @tparam Type
+ * @tparam Allocator Alocador usado para os nós (por exemplo, `PoolAllocator` ou `ArenaAllocator`)
+ */
+template <typename Type, typename Allocator = std::allocator<Type>>
 class Pilha {
  private:
   struct Node {
@@ -19,13 +28,18 @@ class Pilha {
     Node(Type valor) : valor(valor), proximo(nullptr) {}
   };
 
+  using AlocadorNo = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using TraitsNo = std::allocator_traits<AlocadorNo>;
+
   Node* topo;
   size_t tamanho;
+  AlocadorNo alocador;
 
  public:
   // Construtores (o construtor cópia é implementado mais abaixo)
-  Pilha() : topo(nullptr), tamanho(0) {};
-  Pilha(const Pilha<Type>& outraPilha);
+  Pilha() : Pilha(Allocator()) {}
+  explicit Pilha(const Allocator& alocador) : topo(nullptr), tamanho(0), alocador(alocador) {}
+  Pilha(const Pilha<Type, Allocator>& outraPilha);
   // Destrutor (implementado mais abaixo)
   ~Pilha();
 
@@ -80,16 +94,29 @@ class Pilha {
    *
    */
   void print();
+
+  /**
+   * @brief Retorna uma cópia do alocador da pilha
+   *
+   * @return Allocator
+   */
+  Allocator get_allocator() const;
+
+ private:
+  Node* criarNo(const Type& valor);
+  void liberarNo(Node* node);
 };
 
-template <typename Type>
-Pilha<Type>::Pilha(const Pilha<Type>& outraPilha) : Pilha() {
+template <typename Type, typename Allocator>
+Pilha<Type, Allocator>::Pilha(const Pilha<Type, Allocator>& outraPilha)
+    : Pilha(std::allocator_traits<Allocator>::select_on_container_copy_construction(
+          outraPilha.get_allocator())) {
   if (!outraPilha.isEmpty()) {
     // Pegar o ponteiro para o primeiro nó da pilha original
     Node* atualOrig = outraPilha.topo;
 
     // Criar o primeiro nó da nova pilha
-    topo = new Node(atualOrig->valor);
+    topo = criarNo(atualOrig->valor);
     Node* atualCopia = topo;
     ++tamanho;
 
@@ -97,7 +124,7 @@ Pilha<Type>::Pilha(const Pilha<Type>& outraPilha) : Pilha() {
     while (atualOrig->proximo != nullptr) {
       atualOrig = atualOrig->proximo;
       // Cria o novo nó com o dado do nó atual da pilha original
-      Node* temp = new Node(atualOrig->dado);
+      Node* temp = criarNo(atualOrig->valor);
 
       // Conecta o novo nó ao final da cópia
       atualCopia->proximo = temp;
@@ -109,18 +136,18 @@ Pilha<Type>::Pilha(const Pilha<Type>& outraPilha) : Pilha() {
   }
 }
 
-template <typename Type>
-Pilha<Type>::~Pilha() {
+template <typename Type, typename Allocator>
+Pilha<Type, Allocator>::~Pilha() {
   clear();
 }
 
-template <typename Type>
-bool Pilha<Type>::isEmpty() const {
+template <typename Type, typename Allocator>
+bool Pilha<Type, Allocator>::isEmpty() const {
   return topo == nullptr;
 }
 
-template <typename Type>
-void Pilha<Type>::pop() {
+template <typename Type, typename Allocator>
+void Pilha<Type, Allocator>::pop() {
   if (isEmpty()) {
     throw std::out_of_range("A pilha está vazia");
   }
@@ -132,15 +159,15 @@ void Pilha<Type>::pop() {
   topo = topo->proximo;
 
   // Desaloca o nó temporário
-  delete temp;
+  liberarNo(temp);
 
   --tamanho;
 }
 
-template <typename Type>
-void Pilha<Type>::push(Type dado) {
+template <typename Type, typename Allocator>
+void Pilha<Type, Allocator>::push(Type dado) {
   // Cria um novo nó
-  Node* novo = new Node(dado);
+  Node* novo = criarNo(dado);
 
   // O topo se torna o próximo do novo nó
   novo->proximo = topo;
@@ -150,8 +177,8 @@ void Pilha<Type>::push(Type dado) {
   ++tamanho;
 }
 
-template <typename Type>
-Type Pilha<Type>::top() {
+template <typename Type, typename Allocator>
+Type Pilha<Type, Allocator>::top() {
   if (isEmpty()) {
     throw std::out_of_range("A pilha está vazia");
   }
@@ -159,20 +186,29 @@ Type Pilha<Type>::top() {
   return topo->valor;
 }
 
-template <typename Type>
-size_t Pilha<Type>::size() {
+template <typename Type, typename Allocator>
+size_t Pilha<Type, Allocator>::size() {
   return tamanho;
 }
 
-template <typename Type>
-void Pilha<Type>::clear() {
-  while (!isEmpty()) {
-    pop();
+template <typename Type, typename Allocator>
+void Pilha<Type, Allocator>::clear() {
+  // Com uma arena e valores de destrutor trivial, os nós são abandonados sem serem percorridos
+  if (!DescarteSemPercurso<Allocator, Type>::value) {
+    Node* atual = topo;
+    while (atual != nullptr) {
+      Node* posterior = atual->proximo;
+      liberarNo(atual);
+      atual = posterior;
+    }
   }
+
+  topo = nullptr;
+  tamanho = 0;
 }
 
-template <typename Type>
-void Pilha<Type>::print() {
+template <typename Type, typename Allocator>
+void Pilha<Type, Allocator>::print() {
   if (isEmpty()) {
     std::cout << "Pilha vazia!" << std::endl;
     return;
@@ -186,4 +222,27 @@ void Pilha<Type>::print() {
   std::cout << std::endl;
 }
 
+template <typename Type, typename Allocator>
+Allocator Pilha<Type, Allocator>::get_allocator() const {
+  return Allocator(alocador);
+}
+
+template <typename Type, typename Allocator>
+typename Pilha<Type, Allocator>::Node* Pilha<Type, Allocator>::criarNo(const Type& valor) {
+  Node* node = TraitsNo::allocate(alocador, 1);
+  try {
+    TraitsNo::construct(alocador, node, valor);
+  } catch (...) {
+    TraitsNo::deallocate(alocador, node, 1);
+    throw;
+  }
+  return node;
+}
+
+template <typename Type, typename Allocator>
+void Pilha<Type, Allocator>::liberarNo(typename Pilha<Type, Allocator>::Node* node) {
+  TraitsNo::destroy(alocador, node);
+  TraitsNo::deallocate(alocador, node, 1);
+}
+
 #endif
\ No newline at end of file
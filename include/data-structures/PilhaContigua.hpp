@@ -0,0 +1,289 @@
+#ifndef PILHA_CONTIGUA_HPP
+#define PILHA_CONTIGUA_HPP
+
+#include <iostream>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+/**
+ * @brief Pilha armazenada em memória contígua com espaço interno para `N` elementos
+ *
+ * Os primeiros `N` elementos ficam dentro do próprio objeto (sem alocação). Somente quando a pilha
+ * passa de `N` elementos os dados são movidos para um buffer no heap, que cresce dobrando de
+ * tamanho. Como os elementos são vizinhos na memória, `push`, `pop` e `top` não seguem ponteiros.
+ *
+ * @tparam Type
+ * @tparam N Quantidade de elementos armazenados sem alocação
+ */
+template <typename Type, size_t N = 32>
+class PilhaContigua {
+  static_assert(N > 0, "A pilha precisa ter pelo menos uma posicao interna");
+
+ private:
+  /**
+   * @brief Espaço interno (não inicializado) para os primeiros `N` elementos
+   *
+   */
+  alignas(Type) unsigned char interno[N * sizeof(Type)];
+
+  /**
+   * @brief Aponta para `interno` ou para o buffer alocado no heap
+   *
+   */
+  Type* dados;
+
+  size_t tamanho;
+  size_t capacidade;
+
+ public:
+  // Construtores (o construtor cópia é implementado mais abaixo)
+  PilhaContigua() : dados(reinterpret_cast<Type*>(interno)), tamanho(0), capacidade(N) {};
+  PilhaContigua(const PilhaContigua<Type, N>& outraPilha);
+  PilhaContigua(PilhaContigua<Type, N>&& outraPilha);
+  PilhaContigua<Type, N>& operator=(const PilhaContigua<Type, N>&) = delete;
+  // Destrutor (implementado mais abaixo)
+  ~PilhaContigua();
+
+  /**
+   * @brief Remove o último elemento da pilha
+   *
+   * @throw `std::out_of_range` se a pilha estiver vazia
+   */
+  void pop();
+
+  /**
+   * @brief Adiciona um elemento no final da pilha
+   *
+   * @param dado
+   */
+  void push(Type dado);
+
+  /**
+   * @brief Constrói um elemento diretamente no final da pilha
+   *
+   * @param argumentos Argumentos repassados ao construtor de `Type`
+   * @return Type& Referência para o elemento construído
+   */
+  template <typename... Args>
+  Type& emplace(Args&&... argumentos);
+
+  /**
+   * @brief Retorna o último elemento da pilha
+   *
+   * O último elemento da pilha é o próximo a ser removido
+   *
+   * @return Type&
+   *
+   * @throw `std::out_of_range` se a pilha estiver vazia
+   */
+  Type& top();
+
+  /**
+   * @brief Garante espaço para pelo menos `novaCapacidade` elementos sem novas alocações
+   *
+   * @param novaCapacidade
+   */
+  void reserve(size_t novaCapacidade);
+
+  /**
+   * @brief Retorna o tamanho da pilha
+   *
+   * @return size_t
+   */
+  size_t size() const;
+
+  /**
+   * @brief Retorna quantos elementos cabem na pilha sem uma nova alocação
+   *
+   * @return size_t
+   */
+  size_t capacity() const;
+
+  /**
+   * @brief Retorna se a pilha está ou não vazia
+   *
+   * @return true se a pilha estiver vazia
+   * @return false se a pilha não estiver vazia
+   */
+  bool isEmpty() const;
+
+  /**
+   * @brief Limpa (reseta) completamente a pilha
+   *
+   * O buffer do heap, se existir, é mantido para os próximos `push`.
+   */
+  void clear();
+
+  /**
+   * @brief Imprime todos elementos da pilha
+   *
+   */
+  void print();
+
+ private:
+  /**
+   * @brief Retorna se os dados estão no espaço interno
+   *
+   */
+  bool usandoInterno() const;
+
+  /**
+   * @brief Move os elementos para um buffer com a capacidade indicada
+   *
+   * @param novaCapacidade
+   */
+  void realocar(size_t novaCapacidade);
+};
+
+template <typename Type, size_t N>
+PilhaContigua<Type, N>::PilhaContigua(const PilhaContigua<Type, N>& outraPilha) : PilhaContigua() {
+  reserve(outraPilha.tamanho);
+
+  // Copia os elementos na mesma ordem (da base para o topo)
+  for (size_t i = 0; i < outraPilha.tamanho; ++i) {
+    new (dados + i) Type(outraPilha.dados[i]);
+    ++tamanho;
+  }
+}
+
+template <typename Type, size_t N>
+PilhaContigua<Type, N>::PilhaContigua(PilhaContigua<Type, N>&& outraPilha) : PilhaContigua() {
+  if (!outraPilha.usandoInterno()) {
+    // O buffer do heap pode simplesmente trocar de dono
+    dados = outraPilha.dados;
+    tamanho = outraPilha.tamanho;
+    capacidade = outraPilha.capacidade;
+
+    outraPilha.dados = reinterpret_cast<Type*>(outraPilha.interno);
+    outraPilha.tamanho = 0;
+    outraPilha.capacidade = N;
+    return;
+  }
+
+  for (size_t i = 0; i < outraPilha.tamanho; ++i) {
+    new (dados + i) Type(std::move(outraPilha.dados[i]));
+    ++tamanho;
+  }
+  outraPilha.clear();
+}
+
+template <typename Type, size_t N>
+PilhaContigua<Type, N>::~PilhaContigua() {
+  clear();
+
+  if (!usandoInterno()) {
+    ::operator delete(dados);
+  }
+}
+
+template <typename Type, size_t N>
+bool PilhaContigua<Type, N>::usandoInterno() const {
+  return dados == reinterpret_cast<const Type*>(interno);
+}
+
+template <typename Type, size_t N>
+void PilhaContigua<Type, N>::realocar(size_t novaCapacidade) {
+  Type* novos = static_cast<Type*>(::operator new(sizeof(Type) * novaCapacidade));
+
+  for (size_t i = 0; i < tamanho; ++i) {
+    new (novos + i) Type(std::move(dados[i]));
+    dados[i].~Type();
+  }
+
+  if (!usandoInterno()) {
+    ::operator delete(dados);
+  }
+
+  dados = novos;
+  capacidade = novaCapacidade;
+}
+
+template <typename Type, size_t N>
+void PilhaContigua<Type, N>::reserve(size_t novaCapacidade) {
+  if (novaCapacidade > capacidade) {
+    realocar(novaCapacidade);
+  }
+}
+
+template <typename Type, size_t N>
+bool PilhaContigua<Type, N>::isEmpty() const {
+  return tamanho == 0;
+}
+
+template <typename Type, size_t N>
+void PilhaContigua<Type, N>::pop() {
+  if (isEmpty()) {
+    throw std::out_of_range("A pilha está vazia");
+  }
+
+  --tamanho;
+  dados[tamanho].~Type();
+}
+
+template <typename Type, size_t N>
+void PilhaContigua<Type, N>::push(Type dado) {
+  emplace(std::move(dado));
+}
+
+template <typename Type, size_t N>
+template <typename... Args>
+Type& PilhaContigua<Type, N>::emplace(Args&&... argumentos) {
+  // Se não houver mais espaço, dobra a capacidade (saindo do espaço interno na primeira vez).
+  // O elemento é construído antes da realocação, pois os argumentos podem referenciar a pilha
+  if (tamanho == capacidade) {
+    Type temp(std::forward<Args>(argumentos)...);
+    realocar(2 * capacidade);
+
+    Type* novo = new (dados + tamanho) Type(std::move(temp));
+    ++tamanho;
+    return *novo;
+  }
+
+  Type* novo = new (dados + tamanho) Type(std::forward<Args>(argumentos)...);
+  ++tamanho;
+  return *novo;
+}
+
+template <typename Type, size_t N>
+Type& PilhaContigua<Type, N>::top() {
+  if (isEmpty()) {
+    throw std::out_of_range("A pilha está vazia");
+  }
+
+  return dados[tamanho - 1];
+}
+
+template <typename Type, size_t N>
+size_t PilhaContigua<Type, N>::size() const {
+  return tamanho;
+}
+
+template <typename Type, size_t N>
+size_t PilhaContigua<Type, N>::capacity() const {
+  return capacidade;
+}
+
+template <typename Type, size_t N>
+void PilhaContigua<Type, N>::clear() {
+  while (tamanho > 0) {
+    --tamanho;
+    dados[tamanho].~Type();
+  }
+}
+
+template <typename Type, size_t N>
+void PilhaContigua<Type, N>::print() {
+  if (isEmpty()) {
+    std::cout << "Pilha vazia!" << std::endl;
+    return;
+  }
+
+  // Imprime do topo para a base, na mesma ordem da `Pilha`
+  for (size_t i = tamanho; i > 0; --i) {
+    std::cout << dados[i - 1] << " ";
+  }
+  std::cout << std::endl;
+}
+
+#endif
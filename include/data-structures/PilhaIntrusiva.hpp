@@ -0,0 +1,146 @@
+#ifndef PILHA_INTRUSIVA_HPP
+#define PILHA_INTRUSIVA_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+
+#include "Gancho.hpp"
+
+/**
+ * @brief Pilha intrusiva
+ *
+ * Guarda objetos que herdam `Gancho<Marca>` ligando os ganchos deles, sem alocar nem copiar nada:
+ * a pilha não é dona dos objetos, que precisam viver enquanto estiverem ligados.
+ *
+ * O gancho do fundo da pilha aponta para ele mesmo em vez de `nullptr`, então todo gancho ligado
+ * tem `proximo` diferente de `nullptr`, o que permite detectar ligações duplas.
+ *
+ * @tparam Type Tipo dos objetos, que precisa herdar `Gancho<Marca>`
+ * @tparam Marca Marca do gancho usado por esta pilha
+ */
+template <typename Type, typename Marca = void>
+class PilhaIntrusiva {
+ private:
+  using GanchoPilha = Gancho<Marca>;
+
+  /**
+   * @brief Gancho do topo (`nullptr` se a pilha estiver vazia)
+   *
+   */
+  GanchoPilha* topo;
+
+  size_t tamanho;
+
+ public:
+  PilhaIntrusiva() : topo(nullptr), tamanho(0) {}
+  PilhaIntrusiva(const PilhaIntrusiva<Type, Marca>&) = delete;
+  PilhaIntrusiva<Type, Marca>& operator=(const PilhaIntrusiva<Type, Marca>&) = delete;
+  // Destrutor (implementado mais abaixo): desliga os objetos, sem destruí-los
+  ~PilhaIntrusiva();
+
+  /**
+   * @brief Desliga o objeto do topo da pilha, em O(1)
+   *
+   * @throw `std::out_of_range` se a pilha estiver vazia
+   */
+  void pop();
+
+  /**
+   * @brief Liga um objeto no topo da pilha, em O(1)
+   *
+   * @param objeto Objeto que ainda não está ligado por este gancho
+   */
+  void push(Type& objeto);
+
+  /**
+   * @brief Retorna o objeto do topo da pilha
+   *
+   * O objeto do topo é o próximo a ser removido
+   *
+   * @throw `std::out_of_range` se a pilha estiver vazia
+   */
+  Type& top();
+
+  /**
+   * @brief Retorna o tamanho da pilha
+   *
+   * @return size_t
+   */
+  size_t size() const;
+
+  /**
+   * @brief Retorna se a pilha está ou não vazia
+   *
+   * @return true se a pilha estiver vazia
+   * @return false se a pilha não estiver vazia
+   */
+  bool isEmpty() const;
+
+  /**
+   * @brief Desliga todos os objetos da pilha (os objetos não são destruídos)
+   *
+   */
+  void clear();
+};
+
+template <typename Type, typename Marca>
+PilhaIntrusiva<Type, Marca>::~PilhaIntrusiva() {
+  clear();
+}
+
+template <typename Type, typename Marca>
+void PilhaIntrusiva<Type, Marca>::pop() {
+  if (isEmpty()) {
+    throw std::out_of_range("A pilha está vazia");
+  }
+
+  GanchoPilha* antigo = topo;
+
+  // O fundo aponta para ele mesmo
+  topo = antigo->proximo == antigo ? nullptr : antigo->proximo;
+
+  antigo->proximo = nullptr;
+  --tamanho;
+}
+
+template <typename Type, typename Marca>
+void PilhaIntrusiva<Type, Marca>::push(Type& objeto) {
+  GanchoPilha* gancho = &static_cast<GanchoPilha&>(objeto);
+  assert(!gancho->ligado() && "O objeto ja esta ligado a um container");
+
+  // Na pilha vazia, o novo gancho é o fundo e aponta para ele mesmo
+  gancho->proximo = topo != nullptr ? topo : gancho;
+  topo = gancho;
+
+  ++tamanho;
+}
+
+template <typename Type, typename Marca>
+Type& PilhaIntrusiva<Type, Marca>::top() {
+  if (isEmpty()) {
+    throw std::out_of_range("A pilha está vazia");
+  }
+
+  return static_cast<Type&>(*topo);
+}
+
+template <typename Type, typename Marca>
+size_t PilhaIntrusiva<Type, Marca>::size() const {
+  return tamanho;
+}
+
+template <typename Type, typename Marca>
+bool PilhaIntrusiva<Type, Marca>::isEmpty() const {
+  return topo == nullptr;
+}
+
+template <typename Type, typename Marca>
+void PilhaIntrusiva<Type, Marca>::clear() {
+  // Os ganchos são anulados para que os objetos possam ser ligados de novo (ou destruídos)
+  while (!isEmpty()) {
+    pop();
+  }
+}
+
+#endif
@@ -0,0 +1,289 @@
+#ifndef PILHA_LOCK_FREE_HPP
+#define PILHA_LOCK_FREE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+/**
+ * @brief Pilha sem travas (pilha de Treiber) para ser compartilhada entre threads
+ *
+ * Os nós seguem o mesmo formato da `Pilha` (`valor` + `proximo`) e o topo é trocado com
+ * compare-and-swap. Nós removidos não são desalocados imediatamente: eles são "aposentados" e só
+ * são liberados quando nenhuma thread possui um hazard pointer apontando para eles.
+ *
+ * Os hazard pointers também evitam o problema ABA: enquanto um `pop` protege o topo, esse nó não
+ * pode ser liberado, então o endereço dele não volta ao topo por reuso de memória e o
+ * compare-and-swap só funciona se o topo realmente não mudou.
+ *
+ * @tparam Type
+ */
+template <typename Type>
+class PilhaLockFree {
+ private:
+  struct Node {
+    Type valor;
+
+    /**
+     * @brief Aponta para o próximo nó
+     *
+     */
+    Node* proximo;
+
+    /**
+     * @brief Aponta para o próximo nó na lista de nós aposentados
+     *
+     */
+    Node* proximoAposentado;
+
+    Node(Type valor) : valor(std::move(valor)), proximo(nullptr), proximoAposentado(nullptr) {}
+  };
+
+  static constexpr size_t LINHA_CACHE = 64;
+
+  /**
+   * @brief Número máximo de threads que podem estar dentro de um `pop` ao mesmo tempo
+   *
+   */
+  static constexpr size_t MAX_HAZARDS = 128;
+
+  /**
+   * @brief Quantidade de nós aposentados que dispara uma tentativa de liberação
+   *
+   */
+  static constexpr size_t LIMITE_APOSENTADOS = 2 * MAX_HAZARDS;
+
+  /**
+   * @brief Hazard pointer: enquanto aponta para um nó, esse nó não pode ser desalocado
+   *
+   */
+  struct alignas(LINHA_CACHE) Hazard {
+    std::atomic<bool> ocupado;
+    std::atomic<Node*> protegido;
+
+    Hazard() : ocupado(false), protegido(nullptr) {}
+  };
+
+  alignas(LINHA_CACHE) std::atomic<Node*> topo;
+
+  alignas(LINHA_CACHE) std::atomic<size_t> tamanho;
+
+  alignas(LINHA_CACHE) std::atomic<Node*> aposentados;
+  std::atomic<size_t> quantidadeAposentados;
+
+  Hazard hazards[MAX_HAZARDS];
+
+ public:
+  PilhaLockFree() : topo(nullptr), tamanho(0), aposentados(nullptr), quantidadeAposentados(0) {}
+  PilhaLockFree(const PilhaLockFree<Type>&) = delete;
+  PilhaLockFree<Type>& operator=(const PilhaLockFree<Type>&) = delete;
+  ~PilhaLockFree();
+
+  /**
+   * @brief Adiciona um elemento no topo da pilha
+   *
+   * @param dado
+   */
+  void push(Type dado);
+
+  /**
+   * @brief Remove o elemento do topo da pilha
+   *
+   * @param saida Recebe o elemento removido
+   * @return false se a pilha estiver vazia
+   */
+  bool try_pop(Type& saida);
+
+  /**
+   * @brief Retorna o tamanho (aproximado, se houver operações em andamento) da pilha
+   *
+   * @return size_t
+   */
+  size_t size() const;
+
+  /**
+   * @brief Retorna se a pilha está (aproximadamente) vazia
+   *
+   */
+  bool isEmpty() const;
+
+ private:
+  /**
+   * @brief Reserva um hazard pointer livre para a thread atual
+   *
+   */
+  Hazard& adquirirHazard();
+
+  /**
+   * @brief Coloca um nó removido na lista de aposentados e, se ela estiver grande, tenta liberar
+   *
+   */
+  void aposentar(Node* node);
+
+  /**
+   * @brief Libera os nós aposentados que não estão protegidos por nenhum hazard pointer
+   *
+   */
+  void liberarAposentados();
+};
+
+template <typename Type>
+PilhaLockFree<Type>::~PilhaLockFree() {
+  Node* atual = topo.load(std::memory_order_relaxed);
+  while (atual != nullptr) {
+    Node* posterior = atual->proximo;
+    delete atual;
+    atual = posterior;
+  }
+
+  atual = aposentados.load(std::memory_order_relaxed);
+  while (atual != nullptr) {
+    Node* posterior = atual->proximoAposentado;
+    delete atual;
+    atual = posterior;
+  }
+}
+
+template <typename Type>
+typename PilhaLockFree<Type>::Hazard& PilhaLockFree<Type>::adquirirHazard() {
+  while (true) {
+    for (Hazard& hazard : hazards) {
+      if (!hazard.ocupado.load(std::memory_order_relaxed) &&
+          !hazard.ocupado.exchange(true, std::memory_order_acquire)) {
+        return hazard;
+      }
+    }
+
+    // Mais de MAX_HAZARDS threads estão em `pop` ao mesmo tempo; aguarda uma delas terminar
+    std::this_thread::yield();
+  }
+}
+
+template <typename Type>
+void PilhaLockFree<Type>::push(Type dado) {
+  Node* novo = new Node(std::move(dado));
+
+  // O tamanho é incrementado antes de o nó ficar visível para que nunca fique negativo
+  tamanho.fetch_add(1, std::memory_order_relaxed);
+
+  Node* atual = topo.load(std::memory_order_relaxed);
+  do {
+    novo->proximo = atual;
+  } while (!topo.compare_exchange_weak(atual, novo, std::memory_order_release,
+                                       std::memory_order_relaxed));
+}
+
+template <typename Type>
+bool PilhaLockFree<Type>::try_pop(Type& saida) {
+  Hazard& hazard = adquirirHazard();
+  Node* removido;
+
+  while (true) {
+    removido = topo.load(std::memory_order_acquire);
+
+    if (removido == nullptr) {
+      hazard.ocupado.store(false, std::memory_order_release);
+      return false;
+    }
+
+    // Protege o nó e confirma que ele ainda é o topo: a partir daqui ele não será desalocado
+    hazard.protegido.store(removido, std::memory_order_seq_cst);
+    if (topo.load(std::memory_order_seq_cst) != removido) {
+      continue;
+    }
+
+    Node* esperado = removido;
+    if (topo.compare_exchange_strong(esperado, removido->proximo, std::memory_order_acquire,
+                                     std::memory_order_relaxed)) {
+      break;
+    }
+  }
+
+  hazard.protegido.store(nullptr, std::memory_order_release);
+  hazard.ocupado.store(false, std::memory_order_release);
+
+  tamanho.fetch_sub(1, std::memory_order_relaxed);
+  saida = std::move(removido->valor);
+  aposentar(removido);
+  return true;
+}
+
+template <typename Type>
+void PilhaLockFree<Type>::aposentar(typename PilhaLockFree<Type>::Node* node) {
+  // A lista de aposentados só recebe inserções e é esvaziada de uma vez (exchange), então não sofre
+  // do problema ABA
+  Node* cabeca = aposentados.load(std::memory_order_relaxed);
+  do {
+    node->proximoAposentado = cabeca;
+  } while (!aposentados.compare_exchange_weak(cabeca, node, std::memory_order_release,
+                                              std::memory_order_relaxed));
+
+  if (quantidadeAposentados.fetch_add(1, std::memory_order_relaxed) + 1 >= LIMITE_APOSENTADOS) {
+    liberarAposentados();
+  }
+}
+
+template <typename Type>
+void PilhaLockFree<Type>::liberarAposentados() {
+  Node* lista = aposentados.exchange(nullptr, std::memory_order_acquire);
+  if (lista == nullptr) return;
+
+  // Registra os nós protegidos neste momento
+  Node* protegidos[MAX_HAZARDS];
+  size_t quantidadeProtegidos = 0;
+  for (const Hazard& hazard : hazards) {
+    Node* node = hazard.protegido.load(std::memory_order_seq_cst);
+    if (node != nullptr) {
+      protegidos[quantidadeProtegidos++] = node;
+    }
+  }
+
+  size_t liberados = 0;
+  Node* mantidos = nullptr;
+  Node* ultimoMantido = nullptr;
+
+  while (lista != nullptr) {
+    Node* posterior = lista->proximoAposentado;
+
+    bool protegido = false;
+    for (size_t i = 0; i < quantidadeProtegidos && !protegido; ++i) {
+      protegido = protegidos[i] == lista;
+    }
+
+    if (protegido) {
+      lista->proximoAposentado = mantidos;
+      if (mantidos == nullptr) ultimoMantido = lista;
+      mantidos = lista;
+    } else {
+      delete lista;
+      ++liberados;
+    }
+
+    lista = posterior;
+  }
+
+  quantidadeAposentados.fetch_sub(liberados, std::memory_order_relaxed);
+
+  // Devolve os nós ainda protegidos para a lista de aposentados
+  if (mantidos != nullptr) {
+    Node* cabeca = aposentados.load(std::memory_order_relaxed);
+    do {
+      ultimoMantido->proximoAposentado = cabeca;
+    } while (!aposentados.compare_exchange_weak(cabeca, mantidos, std::memory_order_release,
+                                                std::memory_order_relaxed));
+  }
+}
+
+template <typename Type>
+size_t PilhaLockFree<Type>::size() const {
+  return tamanho.load(std::memory_order_relaxed);
+}
+
+template <typename Type>
+bool PilhaLockFree<Type>::isEmpty() const {
+  return topo.load(std::memory_order_acquire) == nullptr;
+}
+
+#endif